@@ -7,6 +7,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "DataManager.h"
+#include "fieldRegistry.h"
 
 #include <cassert>
 #include <iostream>
@@ -27,13 +28,15 @@
 #include "util/stateBasedHelperFunctions.h"
 #include "util/utilIO.h"
 
-data::DataManager::DataManager() {
+data::DataManager::DataManager() : d_fields_p(new data::FieldRegistry()) {
   // if (instances != 0)
   // std::cerr << "Warning you should have exactly one data manager instance"
   //        << std::endl;
   // instances++;
 }
 
+data::DataManager::~DataManager() { delete d_fields_p; }
+
 void data::DataManager::setModelDeckP(inp::ModelDeck* pointer) {
   d_modelDeck_p = pointer;
 }
@@ -162,6 +165,23 @@ std::vector<util::Matrix33>* data::DataManager::getStrainTensorP() {
   return d_strain_p;
 }
 
+void data::DataManager::setShapeTensorP(std::vector<util::Matrix33>* pointer) {
+  d_shapeTensor_p = pointer;
+}
+
+std::vector<util::Matrix33>* data::DataManager::getShapeTensorP() {
+  return d_shapeTensor_p;
+}
+
+void data::DataManager::setShapeTensorInvP(
+    std::vector<util::Matrix33>* pointer) {
+  d_shapeTensorInv_p = pointer;
+}
+
+std::vector<util::Matrix33>* data::DataManager::getShapeTensorInvP() {
+  return d_shapeTensorInv_p;
+}
+
 void data::DataManager::setDilatationP(std::vector<double>* pointer) {
   d_dilatation_p = pointer;
 }
@@ -237,6 +257,7 @@ std::string data::DataManager::printStr(int nt, int lvl) const {
   auto tabS = util::io::getTabS(nt);
   std::ostringstream oss;
   oss << tabS << "------- DataManager --------" << std::endl << std::endl;
+  oss << d_fields_p->printStr(nt + 1, lvl);
   oss << tabS << std::endl;
 
   return oss.str();
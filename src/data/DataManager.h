@@ -54,6 +54,8 @@ class StateBasedHelperFunctions;
 /*! @brief Data mamanger to share the global simulation data between the classes */
 namespace data {
 
+class FieldRegistry;
+
 /*! @brief Data manager to collect the global simulation data */
 class DataManager {
 
@@ -62,6 +64,28 @@ public:
 	/*! @brief Constructor */
 	DataManager();
 
+	/*! @brief Destructor, frees the fields of the registry */
+	~DataManager();
+
+	DataManager(const DataManager &) = delete;
+	DataManager &operator=(const DataManager &) = delete;
+
+	/*!
+	 * @brief Returns the registry owning the per-node fields
+	 *
+	 * Vectors created through the registry and set in the data manager are
+	 * freed with the data manager.
+	 *
+	 * @return Reference Field registry
+	 */
+	FieldRegistry &getFields() { return *d_fields_p; }
+
+	/*!
+	 * @brief Returns the registry owning the per-node fields
+	 * @return Reference Field registry
+	 */
+	const FieldRegistry &getFields() const { return *d_fields_p; }
+
 	/**
 	 * @name Access to the deck objects
 	 *
@@ -266,6 +290,27 @@ public:
 	 */
 	std::vector<util::Matrix33>* getStrainTensorP();
 
+	/*! Sets the pointer to the shape tensor of nodes in the reference
+	 * configuration
+	 * @param pointer Pointer
+	 */
+	void setShapeTensorP(std::vector<util::Matrix33>* pointer);
+
+	/*! Get the pointer to shape tensor
+	 * @return pointer
+	 */
+	std::vector<util::Matrix33>* getShapeTensorP();
+
+	/*! Sets the pointer to the transposed inverse of the shape tensor
+	 * @param pointer Pointer
+	 */
+	void setShapeTensorInvP(std::vector<util::Matrix33>* pointer);
+
+	/*! Get the pointer to transposed inverse of the shape tensor
+	 * @return pointer
+	 */
+	std::vector<util::Matrix33>* getShapeTensorInvP();
+
 	/*! Sets the pointer to the dilatation state
 	 * @param pointer Pointer
 	 */
@@ -409,6 +454,9 @@ private:
 
 	/** @}*/
 
+	/*! @brief Registry owning the per-node fields */
+	FieldRegistry *d_fields_p = nullptr;
+
 	/**
 	 * @name Pointers to the major simulation data
 	 *
@@ -482,6 +530,12 @@ private:
 	/*! @brief Pointer to the stress tensor vector */
     std::vector<util::Matrix33>* d_stress_p = nullptr;
 
+	/*! @brief Pointer to the shape tensor vector */
+	std::vector<util::Matrix33>* d_shapeTensor_p = nullptr;
+
+	/*! @brief Pointer to the transposed inverse of the shape tensor vector */
+	std::vector<util::Matrix33>* d_shapeTensorInv_p = nullptr;
+
 	/** @}*/
 
 	/**@{*/
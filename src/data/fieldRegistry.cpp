@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include "fieldRegistry.h"
+
+#include <iomanip>
+#include <sstream>
+
+#include "util/utilIO.h"
+
+bool data::FieldRegistry::has(const std::string &name) const {
+  for (const auto &f : d_fields)
+    if (f.d_name == name) return true;
+
+  return false;
+}
+
+size_t data::FieldRegistry::getBytes() const {
+  size_t bytes = 0;
+  for (const auto &f : d_fields) bytes += f.getBytes();
+
+  return bytes;
+}
+
+void data::FieldRegistry::checkType(const FieldInfo &f,
+                                    const std::type_index &type) {
+  if (f.d_type != type) {
+    std::cerr << "Error: Field " << f.d_name
+              << " is accessed with a different type than it was created "
+                 "with.\n";
+    exit(1);
+  }
+}
+
+std::string data::FieldRegistry::printStr(int nt, int lvl) const {
+  auto tabS = util::io::getTabS(nt);
+  std::ostringstream oss;
+  oss << tabS << "------- FieldRegistry --------" << std::endl << std::endl;
+  for (const auto &f : d_fields)
+    oss << tabS << std::left << std::setw(28) << f.d_name
+        << " entries = " << f.d_size << ", components = " << f.d_components
+        << ", precision = " << (f.d_scalarBytes == sizeof(float) ? "float"
+                                                                 : "double")
+        << ", lifetime = "
+        << (f.d_lifetime == FieldLifetime::State ? "state" : "output")
+        << ", MB = " << double(f.getBytes()) / (1024. * 1024.) << std::endl;
+  oss << tabS << "Total MB = " << double(getBytes()) / (1024. * 1024.)
+      << std::endl;
+  oss << tabS << std::endl;
+
+  return oss.str();
+}
@@ -0,0 +1,206 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DATA_FIELDREGISTRY_H
+#define DATA_FIELDREGISTRY_H
+
+#include "util/numa.h"          // placement of pages
+#include "util/point.h"         // definition of Point3 and Matrix33
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+namespace data {
+
+/*! @brief Lifetime of a field */
+enum class FieldLifetime {
+  /*! @brief State of the simulation, updated every time step */
+  State = 0,
+  /*! @brief Post-processing data, updated at output */
+  Output
+};
+
+/*! @brief Number of scalar components and bytes per scalar of field types */
+template <class T> struct FieldTraits;
+
+template <> struct FieldTraits<float> {
+  static constexpr size_t c_components = 1;
+  static constexpr size_t c_scalarBytes = sizeof(float);
+};
+
+template <> struct FieldTraits<double> {
+  static constexpr size_t c_components = 1;
+  static constexpr size_t c_scalarBytes = sizeof(double);
+};
+
+template <> struct FieldTraits<util::Point3> {
+  static constexpr size_t c_components = 3;
+  static constexpr size_t c_scalarBytes = sizeof(double);
+};
+
+template <> struct FieldTraits<util::Matrix33> {
+  static constexpr size_t c_components = 9;
+  static constexpr size_t c_scalarBytes = sizeof(double);
+};
+
+/*! @brief Meta data of a field */
+struct FieldInfo {
+
+  /*! @brief Name of field, e.g. the output tag */
+  std::string d_name;
+
+  /*! @brief Number of entries */
+  size_t d_size;
+
+  /*! @brief Number of scalar components per entry */
+  size_t d_components;
+
+  /*! @brief Bytes per scalar component (4 for float, 8 for double) */
+  size_t d_scalarBytes;
+
+  /*! @brief Lifetime of field */
+  FieldLifetime d_lifetime;
+
+  /*! @brief Type of entries */
+  std::type_index d_type;
+
+  /*! @brief Owning pointer to the vector holding the field */
+  std::shared_ptr<void> d_data;
+
+  /*!
+   * @brief Returns the memory of field
+   * @return Bytes Number of bytes
+   */
+  size_t getBytes() const { return d_size * d_components * d_scalarBytes; }
+};
+
+/*! @brief Owns the per-node fields of a simulation
+ *
+ * Fields are created by name and are freed together with the registry, so
+ * that models do not need to delete every vector they have set in
+ * data::DataManager. Each field carries its name, size, precision, and
+ * lifetime, which gives writers one place to discover the fields and gives
+ * a single memory report.
+ *
+ * Fields are allocated with util::Numa::allocate(), i.e. their pages are
+ * placed on the NUMA domains owning the nodes and are advised to be backed
+ * by transparent huge pages.
+ */
+class FieldRegistry {
+
+public:
+  /*!
+   * @brief Constructor
+   */
+  FieldRegistry() = default;
+
+  FieldRegistry(const FieldRegistry &) = delete;
+  FieldRegistry &operator=(const FieldRegistry &) = delete;
+
+  /*!
+   * @brief Creates a field, or resets an existing field of same name
+   * @param name Name of field
+   * @param n Number of entries
+   * @param value Initial value
+   * @param lifetime Lifetime of field
+   * @return Pointer Pointer to the vector holding the field
+   */
+  template <class T>
+  std::vector<T> *add(const std::string &name, size_t n, const T &value,
+                      FieldLifetime lifetime = FieldLifetime::State) {
+    for (auto &f : d_fields)
+      if (f.d_name == name) {
+        checkType(f, std::type_index(typeid(T)));
+        auto *v = static_cast<std::vector<T> *>(f.d_data.get());
+        v->assign(n, value);
+        f.d_size = n;
+        f.d_lifetime = lifetime;
+        return v;
+      }
+
+    std::shared_ptr<std::vector<T>> v(
+        util::Numa::getInstance()->allocate(n, value));
+    d_fields.push_back({name, n, FieldTraits<T>::c_components,
+                        FieldTraits<T>::c_scalarBytes, lifetime,
+                        std::type_index(typeid(T)), v});
+    return v.get();
+  }
+
+  /*!
+   * @brief Returns true if the field exists
+   * @param name Name of field
+   * @return True If field exists
+   */
+  bool has(const std::string &name) const;
+
+  /*!
+   * @brief Returns the field of given name
+   * @param name Name of field
+   * @return Pointer Pointer to the vector holding the field (nullptr if
+   * field does not exist)
+   */
+  template <class T> std::vector<T> *get(const std::string &name) {
+    for (auto &f : d_fields)
+      if (f.d_name == name) {
+        checkType(f, std::type_index(typeid(T)));
+        return static_cast<std::vector<T> *>(f.d_data.get());
+      }
+
+    return nullptr;
+  }
+
+  /*!
+   * @brief Returns the meta data of all fields in order of creation
+   * @return List Meta data of fields
+   */
+  const std::vector<FieldInfo> &getFields() const { return d_fields; }
+
+  /*!
+   * @brief Returns the memory of all fields
+   * @return Bytes Number of bytes
+   */
+  size_t getBytes() const;
+
+  /*!
+   * @brief Returns the string containing information about the instance of
+   * the object
+   *
+   * @param nt Number of tabs to append before each line of string
+   * @param lvl Level of information sought (higher level means more
+   * information)
+   * @return string String containing information about this object
+   * */
+  std::string printStr(int nt = 0, int lvl = 0) const;
+
+  /*!
+   * @brief Prints the information about the instance of the object
+   *
+   * @param nt Number of tabs to append before each line of string
+   * @param lvl Level of information sought (higher level means more
+   * information)
+   * */
+  void print(int nt = 0, int lvl = 0) const { std::cout << printStr(nt, lvl); };
+
+private:
+  /*!
+   * @brief Checks that the field holds entries of given type
+   * @param f Field
+   * @param type Type of entries
+   */
+  static void checkType(const FieldInfo &f, const std::type_index &type);
+
+  /*! @brief Fields in order of creation */
+  std::vector<FieldInfo> d_fields;
+};
+
+} // namespace data
+
+#endif // DATA_FIELDREGISTRY_H
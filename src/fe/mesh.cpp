@@ -38,6 +38,37 @@ fe::Mesh::Mesh(size_t dim)
       d_dim(dim),
       d_keepElementConn(false) {}
 
+fe::Mesh::Mesh(const Mesh &mesh, const std::vector<size_t> &ids)
+    : d_numNodes(ids.size()),
+      d_numElems(0),
+      d_eType(mesh.d_eType),
+      d_eNumVertex(mesh.d_eNumVertex),
+      d_dim(mesh.d_dim),
+      d_spatialDiscretization(mesh.d_spatialDiscretization),
+      d_filename(mesh.d_filename),
+      d_numDofs(ids.size() * mesh.d_dim),
+      d_bbox(mesh.d_bbox),
+      d_h(mesh.d_h),
+      d_keepElementConn(false) {
+  d_nodes.resize(ids.size());
+  d_vol.resize(ids.size());
+  d_fix.resize(ids.size());
+  for (size_t k = 0; k < ids.size(); k++) {
+    d_nodes[k] = mesh.d_nodes[ids[k]];
+    d_vol[k] = mesh.d_vol[ids[k]];
+    d_fix[k] = mesh.d_fix[ids[k]];
+  }
+
+  if (!mesh.d_prescribed_nodes.empty()) {
+    d_prescribed_nodes.resize(ids.size());
+    d_prescribed_values.resize(ids.size());
+    for (size_t k = 0; k < ids.size(); k++) {
+      d_prescribed_nodes[k] = mesh.d_prescribed_nodes[ids[k]];
+      d_prescribed_values[k] = mesh.d_prescribed_values[ids[k]];
+    }
+  }
+}
+
 fe::Mesh::Mesh(inp::MeshDeck *deck)
     : d_numNodes(0),
       d_numElems(0),
@@ -240,7 +271,7 @@ void fe::Mesh::createData(const std::string &filename,
   // if this is weak finite element simulation then check from policy if
   // volume is to be computed
   if (d_spatialDiscretization == "weak_finite_element" and
-      !inp::Policy::getInstance()->populateData("Mesh_d_vol"))
+      !inp::Policy::getInstance()->populateData(inp::PolicyTag::Mesh_d_vol))
     compute_vol = false;
 
   if (compute_vol) {
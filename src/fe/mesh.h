@@ -50,11 +50,6 @@ class Mesh {
 
 public:
 
-  /*!
-   * @brief Constructor
-   */
-  Mesh();
-
   /*!
    * @brief Constructor
    *
@@ -74,6 +69,18 @@ public:
    */
   explicit Mesh(inp::MeshDeck *deck);
 
+  /*!
+   * @brief Constructor for a subset of nodes of a mesh
+   *
+   * Used by the partitions of a distributed model. The mesh size and the
+   * bounding box are those of the full mesh, and element data is not
+   * copied.
+   *
+   * @param mesh Full mesh
+   * @param ids Ids of nodes of the full mesh
+   */
+  Mesh(const Mesh &mesh, const std::vector<size_t> &ids);
+
   /**
    * @name Accessor methods
    */
@@ -173,17 +180,25 @@ public:
 
 /*!
 *  @brief Get the vector of indicies with prescribed values from the couplign method
+*
+* The flag of node i is 1 if the node has prescribed values. A coupled code
+* can modify the data in place before the loading objects are created.
+*
 * @return Vector with the indicies
 */
-  const std::vector<size_t> getPrescribedNodes() const {return d_prescribed_nodes;};
-  std::vector<size_t> getPrescribedNodes() {return d_prescribed_nodes;};
+  const std::vector<size_t> &getPrescribedNodes() const {return d_prescribed_nodes;};
+  std::vector<size_t> &getPrescribedNodes() {return d_prescribed_nodes;};
 
 /*!
 *  @brief Get the vector of values of the prescribed nodes from the couplign method
+*
+* The values are read by the loading objects whenever the loading is applied,
+* so that a coupled code can modify them in place between time steps.
+*
 * @return Vector with the prescribed values
 */
-  const std::vector<util::Point3> getPrescribedValues() const {return d_prescribed_values;};
-  std::vector<util::Point3> getPrescribedValues() {return d_prescribed_values;};
+  const std::vector<util::Point3> &getPrescribedValues() const {return d_prescribed_values;};
+  std::vector<util::Point3> &getPrescribedValues() {return d_prescribed_values;};
 
   /*!
    * @brief Return true if node is free
@@ -350,6 +365,23 @@ public:
    * */
   void print(int nt = 0, int lvl = 0) const { std::cout << printStr(nt, lvl); };
 
+  /*!
+   * @brief Serializes the mesh to send it to another locality
+   *
+   * Used to send the subset of nodes of a partition of a distributed model,
+   * see Mesh(const Mesh &, const std::vector<size_t> &).
+   *
+   * @param ar Archive
+   * @param version Version of archive
+   */
+  template <class Archive> void serialize(Archive &ar, unsigned version) {
+    ar & d_numNodes & d_numElems & d_eType & d_eNumVertex & d_dim;
+    ar & d_nodes & d_enc & d_nec & d_fix & d_vol;
+    ar & d_prescribed_nodes & d_prescribed_values;
+    ar & d_spatialDiscretization & d_filename & d_numDofs & d_gMap & d_gInvMap;
+    ar & d_bbox.first & d_bbox.second & d_h & d_keepElementConn;
+  }
+
 private:
   /**
    * @name Utility methods
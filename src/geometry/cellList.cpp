@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include "cellList.h"
+
+#include <numeric>
+
+#include "util/utilIO.h"
+
+geometry::CellList::CellList(const double &horizon,
+                             const std::vector<util::Point3> *nodes)
+    : d_nodes_p(nodes),
+      d_horizon(horizon),
+      d_horizonSq(horizon * horizon),
+      d_numCells{1, 1, 1} {
+  const size_t nnodes = nodes->size();
+
+  // bounding box of nodes
+  util::Point3 x_max;
+  if (nnodes > 0) {
+    d_xMin = (*nodes)[0];
+    x_max = d_xMin;
+  }
+  for (const auto &x : *nodes)
+    for (size_t d = 0; d < 3; d++) {
+      d_xMin[d] = std::min(d_xMin[d], x[d]);
+      x_max[d] = std::max(x_max[d], x[d]);
+    }
+
+  for (size_t d = 0; d < 3; d++)
+    d_numCells[d] = size_t((x_max[d] - d_xMin[d]) / horizon) + 1;
+
+  // counting sort of nodes by cell
+  d_cellStart = std::vector<size_t>(
+      d_numCells[0] * d_numCells[1] * d_numCells[2] + 1, 0);
+  std::vector<size_t> cellOf(nnodes);
+  for (size_t i = 0; i < nnodes; i++) {
+    const auto &x = (*nodes)[i];
+    cellOf[i] = getCell(x, 0) +
+                d_numCells[0] * (getCell(x, 1) + d_numCells[1] * getCell(x, 2));
+    d_cellStart[cellOf[i] + 1]++;
+  }
+  std::partial_sum(d_cellStart.begin(), d_cellStart.end(),
+                   d_cellStart.begin());
+
+  d_cellNodes = std::vector<size_t>(nnodes);
+  auto pos = d_cellStart;
+  for (size_t i = 0; i < nnodes; i++) d_cellNodes[pos[cellOf[i]]++] = i;
+}
+
+size_t geometry::CellList::getNumNeighbors(const size_t &i) const {
+  size_t n = 0;
+  forEachNeighbor(i, [&n](size_t j) { n++; });
+  return n;
+}
+
+size_t geometry::CellList::getBytes() const {
+  return (d_cellStart.capacity() + d_cellNodes.capacity()) * sizeof(size_t);
+}
+
+std::string geometry::CellList::printStr(int nt, int lvl) const {
+  auto tabS = util::io::getTabS(nt);
+  std::ostringstream oss;
+  oss << tabS << "------- CellList --------" << std::endl << std::endl;
+  oss << tabS << "Number of cells = " << d_numCells[0] << " x "
+      << d_numCells[1] << " x " << d_numCells[2] << std::endl;
+  oss << tabS << "Number of nodes = " << d_cellNodes.size() << std::endl;
+  oss << tabS << "Memory = " << getBytes() << " bytes" << std::endl;
+  oss << tabS << std::endl;
+
+  return oss.str();
+}
@@ -0,0 +1,165 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GEOM_CELLLIST_H
+#define GEOM_CELLLIST_H
+
+#include "util/point.h"         // definition of Point3
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace geometry {
+
+/*! @brief A class to enumerate the neighbors of nodes without storing them
+ *
+ * Nodes are binned into cells of size horizon covering the bounding box of
+ * the nodes. The cells are stored in compressed form, i.e. the ids of nodes
+ * sorted by cell and the offset of each cell, which requires one id per
+ * node and per cell instead of one id per bond as in geometry::Neighbor.
+ * The neighbors of a node are the nodes of the adjacent cells within the
+ * horizon, and they are found again whenever they are needed.
+ *
+ * The neighbors are the same as those of geometry::Neighbor, but they are
+ * enumerated in order of cells and not of distance.
+ */
+class CellList {
+
+public:
+  /*!
+   * @brief Constructor
+   * @param horizon Horizon
+   * @param nodes Pointer to nodal positions
+   */
+  CellList(const double &horizon, const std::vector<util::Point3> *nodes);
+
+  /*!
+   * @brief Calls f(j) for all nodes j in the cells adjacent to the cell of
+   * point x
+   *
+   * This is a superset of the nodes within horizon of x.
+   *
+   * @param x Point
+   * @param f Function called for every node id
+   */
+  template <class F> void forEachNode(const util::Point3 &x, F &&f) const {
+    size_t c[3] = {getCell(x, 0), getCell(x, 1), getCell(x, 2)};
+    for (size_t cz = c[2] > 0 ? c[2] - 1 : 0;
+         cz <= std::min(c[2] + 1, d_numCells[2] - 1); cz++)
+      for (size_t cy = c[1] > 0 ? c[1] - 1 : 0;
+           cy <= std::min(c[1] + 1, d_numCells[1] - 1); cy++) {
+        // cells adjacent in x are contiguous
+        size_t cell = d_numCells[0] * (cy + d_numCells[1] * cz);
+        size_t begin = d_cellStart[cell + (c[0] > 0 ? c[0] - 1 : 0)];
+        size_t end = d_cellStart[cell + std::min(c[0] + 1, d_numCells[0] - 1) +
+                                 1];
+        for (size_t k = begin; k < end; k++) f(d_cellNodes[k]);
+      }
+  }
+
+  /*!
+   * @brief Calls f(j) for all neighbors j of node i
+   * @param i Id of node
+   * @param f Function called for every id of neighboring node
+   */
+  template <class F> void forEachNeighbor(const size_t &i, F &&f) const {
+    const auto &xi = (*d_nodes_p)[i];
+    forEachNode(xi, [&](size_t j) {
+      if (j == i) return;
+
+      // same criterion as the radius search of geometry::Neighbor
+      const auto &xj = (*d_nodes_p)[j];
+      double dx = xi.d_x - xj.d_x;
+      double dist = dx * dx;
+      dx = xi.d_y - xj.d_y;
+      dist += dx * dx;
+      dx = xi.d_z - xj.d_z;
+      dist += dx * dx;
+      if (dist < d_horizonSq) f(j);
+    });
+  }
+
+  /*!
+   * @brief Returns the number of neighbors of node i
+   * @param i Id of node
+   * @return N Number of neighbors
+   */
+  size_t getNumNeighbors(const size_t &i) const;
+
+  /*!
+   * @brief Returns the number of cells
+   * @return N Number of cells
+   */
+  size_t getNumCells() const { return d_cellStart.size() - 1; }
+
+  /*!
+   * @brief Returns the memory of cell list
+   * @return Bytes Number of bytes
+   */
+  size_t getBytes() const;
+
+  /*!
+   * @brief Returns the string containing information about the instance of
+   * the object
+   *
+   * @param nt Number of tabs to append before each line of string
+   * @param lvl Level of information sought (higher level means more
+   * information)
+   * @return string String containing information about this object
+   * */
+  std::string printStr(int nt = 0, int lvl = 0) const;
+
+  /*!
+   * @brief Prints the information about the instance of the object
+   *
+   * @param nt Number of tabs to append before each line of string
+   * @param lvl Level of information sought (higher level means more
+   * information)
+   * */
+  void print(int nt = 0, int lvl = 0) const { std::cout << printStr(nt, lvl); };
+
+private:
+  /*!
+   * @brief Returns the cell index of point in a direction
+   * @param x Point
+   * @param d Direction
+   * @return Index Cell index in direction d
+   */
+  size_t getCell(const util::Point3 &x, size_t d) const {
+    double s = (x[d] - d_xMin[d]) / d_horizon;
+    if (s <= 0.) return 0;
+    return std::min(size_t(s), d_numCells[d] - 1);
+  }
+
+  /*! @brief Pointer to nodal positions */
+  const std::vector<util::Point3> *d_nodes_p;
+
+  /*! @brief Horizon (size of cells) */
+  double d_horizon;
+
+  /*! @brief Square of horizon */
+  double d_horizonSq;
+
+  /*! @brief Lower corner of bounding box of nodes */
+  util::Point3 d_xMin;
+
+  /*! @brief Number of cells in each direction */
+  size_t d_numCells[3];
+
+  /*! @brief Offset of each cell in d_cellNodes (size is number of cells
+   * plus one) */
+  std::vector<size_t> d_cellStart;
+
+  /*! @brief Ids of nodes sorted by cell */
+  std::vector<size_t> d_cellNodes;
+};
+
+} // namespace geometry
+
+#endif // GEOM_CELLLIST_H
@@ -10,6 +10,9 @@
 
 #include <hpx/include/parallel_algorithm.hpp>
 
+#include <algorithm>
+#include <limits>
+
 #include "inp/decks/fractureDeck.h"
 #include "util/utilGeom.h"
 #include "util/utilIO.h"
@@ -42,6 +45,14 @@ geometry::Fracture::Fracture(
   f.get();
 }
 
+geometry::Fracture::Fracture(inp::FractureDeck *deck,
+                             const Fracture &reference)
+    : d_fractureDeck_p(deck), d_fracture(reference.d_fracture) {
+  // initial cracks are already applied in the reference state
+  for (auto &crack : d_fractureDeck_p->d_cracks)
+    if (crack.d_activationTime < 0.) crack.d_crackAcrivated = true;
+}
+
 bool geometry::Fracture::addCrack(
     const double &time, const std::vector<util::Point3> *nodes,
     const std::vector<std::vector<size_t>> *neighbor_list) {
@@ -70,6 +81,14 @@ bool geometry::Fracture::addCrack(
   return false;
 }
 
+double geometry::Fracture::getNextActivationTime() const {
+  double time = std::numeric_limits<double>::max();
+  for (const auto &crack : d_fractureDeck_p->d_cracks)
+    if (!crack.d_crackAcrivated) time = std::min(time, crack.d_activationTime);
+
+  return time;
+}
+
 void geometry::Fracture::computeFracturedBondFd(
     const size_t &i, inp::EdgeCrack *crack,
     const std::vector<util::Point3> *nodes,
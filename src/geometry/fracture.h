@@ -46,6 +46,18 @@ public:
    */
   explicit Fracture(inp::FractureDeck *deck);
 
+  /*!
+   * @brief Constructor
+   *
+   * Copies the initial state of bonds from a fracture object built with the
+   * same cracks, e.g. to avoid recomputing it for every member of an
+   * ensemble.
+   *
+   * @param deck Input deck which contains user-specified information
+   * @param reference Fracture object to copy the state of bonds from
+   */
+  Fracture(inp::FractureDeck *deck, const Fracture &reference);
+
   /*!
    * @brief Sets fracture state according to the crack data
    * @param time Actual simulation time
@@ -56,6 +68,12 @@ public:
   bool addCrack(const double &time, const std::vector<util::Point3> *nodes,
             const std::vector<std::vector<size_t>> *neighbor_list);
 
+  /*!
+   * @brief Returns the smallest activation time of cracks not yet added
+   * @return time Activation time or largest double if all cracks are added
+   */
+  double getNextActivationTime() const;
+
   /*!
    * @brief Sets the bond state
    *
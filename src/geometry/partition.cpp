@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include "partition.h"
+
+#include <hpx/include/parallel_algorithm.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+#include "cellList.h"
+#include "util/utilGeom.h"
+#include "util/utilIO.h"
+
+geometry::Partition::Partition(size_t numParts, size_t rank,
+                               const std::vector<util::Point3> &nodes,
+                               const double &horizon)
+    : Partition(numParts, rank, nodes, horizon, getOwners(numParts, nodes)) {}
+
+std::vector<size_t> geometry::Partition::getOwners(
+    size_t numParts, const std::vector<util::Point3> &nodes) {
+  const size_t nnodes = nodes.size();
+
+  // bounding box of nodes
+  util::Point3 x_min = nodes.empty() ? util::Point3() : nodes[0];
+  util::Point3 x_max = x_min;
+  for (const auto &x : nodes)
+    for (size_t d = 0; d < 3; d++) {
+      x_min[d] = std::min(x_min[d], x[d]);
+      x_max[d] = std::max(x_max[d], x[d]);
+    }
+
+  // cut nodes sorted along the Morton curve into partitions of equal size
+  std::vector<uint64_t> keys(nnodes);
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, nnodes, [&](boost::uint64_t i) {
+        keys[i] = util::geometry::getMortonKey(nodes[i], x_min, x_max);
+      });
+
+  std::vector<size_t> order(nnodes);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&keys](size_t a, size_t b) { return keys[a] < keys[b]; });
+  keys.clear();
+
+  std::vector<size_t> owner(nnodes);
+  for (size_t k = 0; k < nnodes; k++) owner[order[k]] = k * numParts / nnodes;
+
+  return owner;
+}
+
+geometry::Partition::Partition(size_t numParts, size_t rank,
+                               const std::vector<util::Point3> &nodes,
+                               const double &horizon,
+                               const std::vector<size_t> &owner)
+    : d_numParts(numParts), d_rank(rank), d_numOwned(0) {
+  const size_t nnodes = nodes.size();
+
+  // bin nodes into cells of size horizon
+  const CellList cells(horizon, &nodes);
+
+  // nodes of other partitions within horizon of owned nodes are ghosts and
+  // owned nodes within horizon of other partitions are sent to them (with
+  // a small tolerance to include all nodes found by the neighbor search)
+  const double h_sq = horizon * horizon * (1. + 1.0E-10);
+  std::vector<uint8_t> isGhost(nnodes, 0);
+  std::vector<std::vector<size_t>> sendGlobal(numParts);
+  std::vector<size_t> parts;
+  for (size_t i = 0; i < nnodes; i++) {
+    if (owner[i] != rank) continue;
+
+    parts.clear();
+    cells.forEachNode(nodes[i], [&](size_t j) {
+      if (owner[j] == rank) return;
+
+      auto dx = nodes[j] - nodes[i];
+      if (dx.d_x * dx.d_x + dx.d_y * dx.d_y + dx.d_z * dx.d_z > h_sq) return;
+
+      isGhost[j] = 1;
+      parts.push_back(owner[j]);
+    });
+
+    std::sort(parts.begin(), parts.end());
+    parts.erase(std::unique(parts.begin(), parts.end()), parts.end());
+    for (auto r : parts) sendGlobal[r].push_back(i);
+  }
+
+  // owned nodes followed by ghost nodes grouped by owner
+  std::vector<std::vector<size_t>> ghosts(numParts);
+  for (size_t i = 0; i < nnodes; i++) {
+    if (owner[i] == rank) d_globalIds.push_back(i);
+    if (isGhost[i]) ghosts[owner[i]].push_back(i);
+  }
+  d_numOwned = d_globalIds.size();
+
+  // local ids of owned nodes
+  std::vector<size_t> localId(nnodes, 0);
+  for (size_t k = 0; k < d_numOwned; k++) localId[d_globalIds[k]] = k;
+
+  d_recvOffsets.push_back(d_numOwned);
+  for (size_t r = 0; r < numParts; r++) {
+    if (ghosts[r].empty() and sendGlobal[r].empty()) continue;
+
+    d_neighborParts.push_back(r);
+    d_globalIds.insert(d_globalIds.end(), ghosts[r].begin(), ghosts[r].end());
+    d_recvOffsets.push_back(d_globalIds.size());
+
+    d_sendNodes.emplace_back();
+    for (auto i : sendGlobal[r]) d_sendNodes.back().push_back(localId[i]);
+  }
+}
+
+std::string geometry::Partition::printStr(int nt, int lvl) const {
+  auto tabS = util::io::getTabS(nt);
+
+  size_t nsend = 0;
+  for (const auto &list : d_sendNodes) nsend += list.size();
+
+  std::ostringstream oss;
+  oss << tabS << "------- Partition --------" << std::endl << std::endl;
+  oss << tabS << "Partition = " << d_rank << " of " << d_numParts
+      << std::endl;
+  oss << tabS << "Number of owned nodes = " << d_numOwned << std::endl;
+  oss << tabS << "Number of ghost nodes = "
+      << d_globalIds.size() - d_numOwned << std::endl;
+  oss << tabS << "Number of sent nodes = " << nsend << std::endl;
+  oss << tabS << "Number of neighboring partitions = "
+      << d_neighborParts.size() << std::endl;
+  oss << tabS << std::endl;
+
+  return oss.str();
+}
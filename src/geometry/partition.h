@@ -0,0 +1,193 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GEOM_PARTITION_H
+#define GEOM_PARTITION_H
+
+#include "util/point.h"         // definition of Point3
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace geometry {
+
+/*! @brief A class to decompose the nodes into partitions with ghost layers
+ *
+ * Nodes are sorted along the Morton (z-order) curve of their reference
+ * position and the sorted list is cut into partitions of equal number of
+ * nodes. The partition owns its nodes and holds the nodes of other
+ * partitions within the horizon of its nodes as ghost nodes.
+ *
+ * Local ids of nodes are ordered as follows: owned nodes in ascending
+ * global id followed by ghost nodes grouped by their owner, each group in
+ * ascending global id. Thus, the ghosts received from a partition are a
+ * contiguous range of local ids, and the nodes sent to a partition are
+ * listed in the same order in which the receiving partition stores them.
+ */
+class Partition {
+
+public:
+  /*!
+   * @brief Constructor
+   *
+   * Creates an empty partition, e.g. to receive a partition from another
+   * locality.
+   */
+  Partition() : d_numParts(0), d_rank(0), d_numOwned(0) {}
+
+  /*!
+   * @brief Constructor
+   * @param numParts Number of partitions
+   * @param rank Id of this partition
+   * @param nodes Nodal positions of all nodes
+   * @param horizon Horizon
+   */
+  Partition(size_t numParts, size_t rank,
+            const std::vector<util::Point3> &nodes, const double &horizon);
+
+  /*!
+   * @brief Constructor
+   *
+   * Creates the partition for given owners of nodes, so that the owners are
+   * computed only once when all partitions are created by one locality.
+   *
+   * @param numParts Number of partitions
+   * @param rank Id of this partition
+   * @param nodes Nodal positions of all nodes
+   * @param horizon Horizon
+   * @param owner Partition owning each node, see getOwners()
+   */
+  Partition(size_t numParts, size_t rank,
+            const std::vector<util::Point3> &nodes, const double &horizon,
+            const std::vector<size_t> &owner);
+
+  /*!
+   * @brief Returns the partition owning each node
+   *
+   * Nodes are sorted along the Morton curve and the sorted list is cut into
+   * partitions of equal number of nodes.
+   *
+   * @param numParts Number of partitions
+   * @param nodes Nodal positions of all nodes
+   * @return list Id of partition owning each node
+   */
+  static std::vector<size_t> getOwners(size_t numParts,
+                                       const std::vector<util::Point3> &nodes);
+
+  /*!
+   * @brief Returns the number of partitions
+   * @return N Number of partitions
+   */
+  size_t getNumParts() const { return d_numParts; }
+
+  /*!
+   * @brief Returns the id of this partition
+   * @return Rank Id of partition
+   */
+  size_t getRank() const { return d_rank; }
+
+  /*!
+   * @brief Returns the number of owned nodes
+   * @return N Number of owned nodes (local ids 0 to N - 1)
+   */
+  size_t getNumOwnedNodes() const { return d_numOwned; }
+
+  /*!
+   * @brief Returns the number of owned and ghost nodes
+   * @return N Number of local nodes
+   */
+  size_t getNumLocalNodes() const { return d_globalIds.size(); }
+
+  /*!
+   * @brief Returns the global ids of local nodes
+   * @return list Global ids
+   */
+  const std::vector<size_t> &getGlobalIds() const { return d_globalIds; }
+
+  /*!
+   * @brief Returns the partitions exchanging nodes with this partition
+   * @return list Ids of partitions in ascending order
+   */
+  const std::vector<size_t> &getNeighborParts() const {
+    return d_neighborParts;
+  }
+
+  /*!
+   * @brief Returns the owned nodes which are ghosts of other partition
+   * @param k Index in list of neighboring partitions
+   * @return list Local ids of nodes
+   */
+  const std::vector<size_t> &getSendNodes(size_t k) const {
+    return d_sendNodes[k];
+  }
+
+  /*!
+   * @brief Returns the range of ghost nodes owned by other partition
+   * @param k Index in list of neighboring partitions
+   * @return pair First and one past the last local id of ghost nodes
+   */
+  std::pair<size_t, size_t> getRecvRange(size_t k) const {
+    return {d_recvOffsets[k], d_recvOffsets[k + 1]};
+  }
+
+  /*!
+   * @brief Returns the string containing information about the instance of
+   * the object
+   *
+   * @param nt Number of tabs to append before each line of string
+   * @param lvl Level of information sought (higher level means more
+   * information)
+   * @return string String containing information about this object
+   * */
+  std::string printStr(int nt = 0, int lvl = 0) const;
+
+  /*!
+   * @brief Prints the information about the instance of the object
+   *
+   * @param nt Number of tabs to append before each line of string
+   * @param lvl Level of information sought (higher level means more
+   * information)
+   * */
+  void print(int nt = 0, int lvl = 0) const { std::cout << printStr(nt, lvl); };
+
+  /*!
+   * @brief Serializes the partition to send it to another locality
+   * @param ar Archive
+   * @param version Version of archive
+   */
+  template <class Archive> void serialize(Archive &ar, unsigned version) {
+    ar & d_numParts & d_rank & d_numOwned;
+    ar & d_globalIds & d_neighborParts & d_sendNodes & d_recvOffsets;
+  }
+
+private:
+  /*! @brief Number of partitions */
+  size_t d_numParts;
+
+  /*! @brief Id of this partition */
+  size_t d_rank;
+
+  /*! @brief Number of owned nodes */
+  size_t d_numOwned;
+
+  /*! @brief Global ids of owned nodes followed by ghost nodes */
+  std::vector<size_t> d_globalIds;
+
+  /*! @brief Partitions exchanging nodes with this partition */
+  std::vector<size_t> d_neighborParts;
+
+  /*! @brief Local ids of owned nodes sent to neighboring partitions */
+  std::vector<std::vector<size_t>> d_sendNodes;
+
+  /*! @brief Offsets of ghost nodes received from neighboring partitions */
+  std::vector<size_t> d_recvOffsets;
+};
+
+} // namespace geometry
+
+#endif // GEOM_PARTITION_H
@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sparseFracture.h"
+
+#include <hpx/include/parallel_algorithm.hpp>
+
+#include <limits>
+
+#include "cellList.h"
+#include "inp/decks/fractureDeck.h"
+#include "util/compare.h"
+#include "util/utilIO.h"
+
+geometry::SparseFracture::SparseFracture(
+    inp::FractureDeck *deck, const std::vector<util::Point3> *nodes,
+    const CellList *cellList)
+    : d_fractureDeck_p(deck), d_broken(nodes->size()) {
+  auto f = hpx::experimental::for_loop(
+      hpx::execution::par(hpx::execution::task), 0, nodes->size(),
+      [this, nodes, cellList](boost::uint64_t i) {
+        for (auto &crack : d_fractureDeck_p->d_cracks)
+          if (crack.d_activationTime < 0.)
+            this->computeFracturedBondFd(i, &crack, nodes, cellList);
+      });  // end of parallel for loop
+
+  f.get();
+
+  for (auto &crack : d_fractureDeck_p->d_cracks)
+    if (crack.d_activationTime < 0.) crack.d_crackAcrivated = true;
+}
+
+bool geometry::SparseFracture::addCrack(const double &time,
+                                        const std::vector<util::Point3> *nodes,
+                                        const CellList *cellList) {
+  for (auto &crack : d_fractureDeck_p->d_cracks) {
+    if (!crack.d_crackAcrivated) {
+      if (util::compare::definitelyLessThan(crack.d_activationTime, time)) {
+        std::cout << "SparseFracture: Adding crack to system\n";
+
+        auto f = hpx::experimental::for_loop(
+            hpx::execution::par(hpx::execution::task), 0, nodes->size(),
+            [this, nodes, cellList, &crack](boost::uint64_t i) {
+              this->computeFracturedBondFd(i, &crack, nodes, cellList);
+            });  // end of parallel for loop
+
+        f.get();
+
+        crack.d_crackAcrivated = true;
+
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+double geometry::SparseFracture::getNextActivationTime() const {
+  double time = std::numeric_limits<double>::max();
+  for (const auto &crack : d_fractureDeck_p->d_cracks)
+    if (!crack.d_crackAcrivated) time = std::min(time, crack.d_activationTime);
+
+  return time;
+}
+
+void geometry::SparseFracture::computeFracturedBondFd(
+    const size_t &i, inp::EdgeCrack *crack,
+    const std::vector<util::Point3> *nodes, const CellList *cellList) {
+  // same rule as geometry::Fracture::computeFracturedBondFd(): bonds to
+  // nodes within the crack line on the opposite side are broken
+  util::Point3 i_node = (*nodes)[i];
+  util::Point3 pb = crack->d_pb;
+  util::Point3 pt = crack->d_pt;
+
+  if (crack->ptOutside(i_node, crack->d_o, pb, pt)) return;
+
+  bool left_side = crack->ptLeftside(i_node, pb, pt);
+
+  cellList->forEachNeighbor(i, [&](size_t j) {
+    util::Point3 j_node = (*nodes)[j];
+    if (crack->ptOutside(j_node, crack->d_o, pb, pt)) return;
+
+    if (left_side ? crack->ptRightside(j_node, pb, pt)
+                  : crack->ptLeftside(j_node, pb, pt))
+      this->setBondState(i, j, true);
+  });
+}
+
+void geometry::SparseFracture::setBondState(const size_t &i, const size_t &j,
+                                            const bool &state) {
+  auto &b = d_broken[i];
+  auto it = std::lower_bound(b.begin(), b.end(), j);
+  bool found = it != b.end() and *it == j;
+
+  if (state and !found)
+    b.insert(it, j);
+  else if (!state and found)
+    b.erase(it);
+}
+
+size_t geometry::SparseFracture::getBytes() const {
+  size_t bytes = d_broken.capacity() * sizeof(std::vector<size_t>);
+  for (const auto &b : d_broken) bytes += b.capacity() * sizeof(size_t);
+
+  return bytes;
+}
+
+std::string geometry::SparseFracture::printStr(int nt, int lvl) const {
+  auto tabS = util::io::getTabS(nt);
+  std::ostringstream oss;
+  oss << tabS << "------- SparseFracture --------" << std::endl << std::endl;
+  oss << tabS << "Fracture deck address = " << d_fractureDeck_p << std::endl;
+  oss << tabS << "Number of data = " << d_broken.size() << std::endl;
+  oss << tabS << std::endl;
+
+  return oss.str();
+}
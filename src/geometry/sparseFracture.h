@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GEOM_SPARSEFRACTURE_H
+#define GEOM_SPARSEFRACTURE_H
+
+#include "util/point.h" // definition of Point3
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace inp {
+struct EdgeCrack;
+struct FractureDeck;
+} // namespace inp
+
+namespace geometry {
+
+class CellList;
+
+/*! @brief A class for fracture state of bonds which stores only broken
+ * bonds
+ *
+ * geometry::Fracture stores one bit per bond, addressed by the local id of
+ * the bond in the neighbor list. When bonds are enumerated from a
+ * geometry::CellList there are no local ids, and for each node only the
+ * sorted list of global ids of nodes with broken bond is stored. As most
+ * bonds stay intact, this needs much less memory than one bit per bond.
+ *
+ * The state of bonds of node i is only modified by the task computing the
+ * force of node i, so that no locking is needed.
+ */
+class SparseFracture {
+
+public:
+  /*!
+   * @brief Constructor
+   *
+   * Breaks the bonds crossing the initial cracks.
+   *
+   * @param deck Input deck which contains user-specified information
+   * @param nodes Pointer to nodal positions
+   * @param cellList Cell list to enumerate the bonds
+   */
+  SparseFracture(inp::FractureDeck *deck,
+                 const std::vector<util::Point3> *nodes,
+                 const CellList *cellList);
+
+  /*!
+   * @brief Adds crack if its activation time is reached
+   * @param time Current time
+   * @param nodes Pointer to nodal positions
+   * @param cellList Cell list to enumerate the bonds
+   * @return True If crack is added
+   */
+  bool addCrack(const double &time, const std::vector<util::Point3> *nodes,
+                const CellList *cellList);
+
+  /*!
+   * @brief Returns the earliest activation time of cracks not yet added
+   * @return Time Activation time (maximum double if there is none)
+   */
+  double getNextActivationTime() const;
+
+  /*!
+   * @brief Sets the bond state
+   * @param i Id of node
+   * @param j Global id of neighboring node
+   * @param state State which is applied to the bond
+   */
+  void setBondState(const size_t &i, const size_t &j, const bool &state);
+
+  /*!
+   * @brief Returns the bond state
+   * @param i Id of node
+   * @param j Global id of neighboring node
+   * @return bool True if bond is broken
+   */
+  bool getBondState(const size_t &i, const size_t &j) const {
+    const auto &b = d_broken[i];
+    return !b.empty() and std::binary_search(b.begin(), b.end(), j);
+  }
+
+  /*!
+   * @brief Returns the number of broken bonds of node
+   * @param i Id of node
+   * @return N Number of broken bonds
+   */
+  size_t getNumBrokenBonds(const size_t &i) const {
+    return d_broken[i].size();
+  }
+
+  /*!
+   * @brief Returns the memory of fracture state
+   * @return Bytes Number of bytes
+   */
+  size_t getBytes() const;
+
+  /*!
+   * @brief Returns the string containing information about the instance of
+   * the object
+   *
+   * @param nt Number of tabs to append before each line of string
+   * @param lvl Level of information sought (higher level means more
+   * information)
+   * @return string String containing information about this object
+   * */
+  std::string printStr(int nt = 0, int lvl = 0) const;
+
+  /*!
+   * @brief Prints the information about the instance of the object
+   *
+   * @param nt Number of tabs to append before each line of string
+   * @param lvl Level of information sought (higher level means more
+   * information)
+   * */
+  void print(int nt = 0, int lvl = 0) const { std::cout << printStr(nt, lvl); };
+
+private:
+  /*!
+   * @brief Breaks the bonds of node crossing the crack
+   * @param i Id of node
+   * @param crack Crack
+   * @param nodes Pointer to nodal positions
+   * @param cellList Cell list to enumerate the bonds
+   */
+  void computeFracturedBondFd(const size_t &i, inp::EdgeCrack *crack,
+                              const std::vector<util::Point3> *nodes,
+                              const CellList *cellList);
+
+  /*! @brief Fracture deck */
+  inp::FractureDeck *d_fractureDeck_p;
+
+  /*! @brief Sorted global ids of nodes with broken bond for each node */
+  std::vector<std::vector<size_t>> d_broken;
+};
+
+} // namespace geometry
+
+#endif // GEOM_SPARSEFRACTURE_H
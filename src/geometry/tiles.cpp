@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tiles.h"
+
+#include <hpx/include/parallel_algorithm.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+
+#include "util/utilGeom.h"
+#include "util/utilIO.h"
+
+geometry::Tiles::Tiles(size_t numTiles, const std::vector<util::Point3> &nodes,
+                       const std::vector<std::vector<size_t>> &neighborList,
+                       const std::string &ordering)
+    : d_reach(0) {
+  if (ordering != "morton" and ordering != "slab") {
+    std::cerr << "Error: Tile ordering " << ordering
+              << " is not supported. Use morton or slab.\n";
+    exit(1);
+  }
+
+  const size_t nnodes = nodes.size();
+  numTiles = std::max(size_t(1), std::min(numTiles, nnodes));
+
+  // bounding box of nodes
+  util::Point3 x_min = nodes.empty() ? util::Point3() : nodes[0];
+  util::Point3 x_max = x_min;
+  for (const auto &x : nodes)
+    for (size_t d = 0; d < 3; d++) {
+      x_min[d] = std::min(x_min[d], x[d]);
+      x_max[d] = std::max(x_max[d], x[d]);
+    }
+
+  std::vector<size_t> order(nnodes);
+  std::iota(order.begin(), order.end(), 0);
+
+  if (ordering == "morton") {
+    // sort nodes along the Morton curve
+    std::vector<uint64_t> keys(nnodes);
+    hpx::experimental::for_loop(
+        hpx::execution::par, 0, nnodes, [&](boost::uint64_t i) {
+          keys[i] = util::geometry::getMortonKey(nodes[i], x_min, x_max);
+        });
+
+    std::stable_sort(order.begin(), order.end(),
+                     [&keys](size_t a, size_t b) { return keys[a] < keys[b]; });
+  } else {
+    // sort nodes along the longest axis of bounding box
+    size_t axis = 0;
+    for (size_t d = 1; d < 3; d++)
+      if (x_max[d] - x_min[d] > x_max[axis] - x_min[axis]) axis = d;
+
+    std::stable_sort(order.begin(), order.end(),
+                     [&nodes, axis](size_t a, size_t b) {
+                       return nodes[a][axis] < nodes[b][axis];
+                     });
+  }
+
+  // cut sorted list into tiles of equal size
+  d_nodes.resize(numTiles);
+  d_tile.resize(nnodes);
+  for (size_t t = 0; t < numTiles; t++) {
+    size_t begin = t * nnodes / numTiles;
+    size_t end = (t + 1) * nnodes / numTiles;
+
+    d_nodes[t].assign(order.begin() + begin, order.begin() + end);
+    std::sort(d_nodes[t].begin(), d_nodes[t].end());
+    for (auto i : d_nodes[t]) d_tile[i] = t;
+  }
+
+  // tiles which hold neighbors of nodes of the tile
+  d_neighborTiles.resize(numTiles);
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, numTiles, [&](boost::uint64_t t) {
+        auto &list = d_neighborTiles[t];
+        list.push_back(t);
+        for (auto i : d_nodes[t])
+          for (auto j : neighborList[i]) list.push_back(d_tile[j]);
+
+        std::sort(list.begin(), list.end());
+        list.erase(std::unique(list.begin(), list.end()), list.end());
+      });
+
+  for (size_t t = 0; t < numTiles; t++)
+    d_reach = std::max(d_reach, std::max(t - d_neighborTiles[t].front(),
+                                         d_neighborTiles[t].back() - t));
+}
+
+std::string geometry::Tiles::printStr(int nt, int lvl) const {
+  auto tabS = util::io::getTabS(nt);
+
+  size_t max_neigh = 0;
+  for (const auto &list : d_neighborTiles)
+    max_neigh = std::max(max_neigh, list.size());
+
+  std::ostringstream oss;
+  oss << tabS << "------- Tiles --------" << std::endl << std::endl;
+  oss << tabS << "Number of tiles = " << d_nodes.size() << std::endl;
+  oss << tabS << "Maximum number of neighboring tiles = " << max_neigh
+      << std::endl;
+  oss << tabS << "Reach = " << d_reach << std::endl;
+  oss << tabS << std::endl;
+
+  return oss.str();
+}
@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GEOM_TILES_H
+#define GEOM_TILES_H
+
+#include "util/point.h"         // definition of Point3
+#include <string>
+#include <vector>
+
+namespace geometry {
+
+/*! @brief A class to decompose the nodes into spatial tiles
+ *
+ * Nodes are sorted along the Morton (z-order) curve of their reference
+ * position and the sorted list is cut into tiles of equal number of nodes.
+ * Thus, each tile is a compact region of the domain. For each tile, the list
+ * of tiles which contain a neighbor of a node of the tile is stored. These
+ * are the tiles the force computation of the tile depends on.
+ *
+ * Alternatively, nodes can be sorted along the longest axis of the bounding
+ * box (slab ordering). Then a tile only depends on tiles with nearby ids,
+ * which is required for the wavefront (temporal blocking) scheme.
+ */
+class Tiles {
+
+public:
+  /*!
+   * @brief Constructor
+   * @param numTiles Number of tiles
+   * @param nodes Nodal positions
+   * @param neighborList Neighbor list of nodes
+   * @param ordering Ordering of nodes (morton or slab)
+   */
+  Tiles(size_t numTiles, const std::vector<util::Point3> &nodes,
+        const std::vector<std::vector<size_t>> &neighborList,
+        const std::string &ordering = "morton");
+
+  /*!
+   * @brief Returns the number of tiles
+   * @return N Number of tiles
+   */
+  size_t getNumTiles() const { return d_nodes.size(); }
+
+  /*!
+   * @brief Returns the ids of nodes in tile
+   * @param t Id of tile
+   * @return list Ids of nodes in ascending order
+   */
+  const std::vector<size_t> &getNodes(size_t t) const { return d_nodes[t]; }
+
+  /*!
+   * @brief Returns the tile of node
+   * @param i Id of node
+   * @return t Id of tile
+   */
+  size_t getTile(size_t i) const { return d_tile[i]; }
+
+  /*!
+   * @brief Returns the tiles containing neighbors of the nodes of tile
+   * @param t Id of tile
+   * @return list Ids of tiles in ascending order including t
+   */
+  const std::vector<size_t> &getNeighborTiles(size_t t) const {
+    return d_neighborTiles[t];
+  }
+
+  /*!
+   * @brief Returns the reach of tiles
+   *
+   * Reach is the maximum of |t - s| over all tiles t and their neighboring
+   * tiles s.
+   *
+   * @return w Reach
+   */
+  size_t getReach() const { return d_reach; }
+
+  /*!
+   * @brief Returns the string containing information about the instance of
+   * the object
+   *
+   * @param nt Number of tabs to append before each line of string
+   * @param lvl Level of information sought (higher level means more
+   * information)
+   * @return string String containing information about this object
+   * */
+  std::string printStr(int nt = 0, int lvl = 0) const;
+
+  /*!
+   * @brief Prints the information about the instance of the object
+   *
+   * @param nt Number of tabs to append before each line of string
+   * @param lvl Level of information sought (higher level means more
+   * information)
+   * */
+  void print(int nt = 0, int lvl = 0) const { std::cout << printStr(nt, lvl); };
+
+private:
+  /*! @brief Ids of nodes in tiles */
+  std::vector<std::vector<size_t>> d_nodes;
+
+  /*! @brief Tile of nodes */
+  std::vector<size_t> d_tile;
+
+  /*! @brief Tiles containing neighbors of the nodes of tiles */
+  std::vector<std::vector<size_t>> d_neighborTiles;
+
+  /*! @brief Maximum distance between ids of tile and its neighboring tile */
+  size_t d_reach;
+};
+
+} // namespace geometry
+
+#endif // GEOM_TILES_H
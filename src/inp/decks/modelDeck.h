@@ -52,6 +52,11 @@ struct ModelDeck {
    * - *empty string*
    * - \a **central_difference**
    * - \a **velocity_verlet**
+   * - \a **dynamic_relaxation**
+   * - \a **multirate_verlet**
+   * - \a **quasi_static**
+   * - \a **newmark**
+   * - \a **hht_alpha**
    */
   std::string d_timeDiscretization;
 
@@ -87,12 +92,115 @@ struct ModelDeck {
    */
   size_t d_RelaxN;
 
+  /**
+   * @name Dynamic relaxation
+   *
+   * Used when the time discretization is \a dynamic_relaxation. Each of the
+   * d_Nt steps is then a load step which is relaxed to static equilibrium.
+   */
+  /**@{*/
+
+  /*! @brief Tolerance on the residual relative to the initial residual of the
+   * load step */
+  double d_drTol;
+
+  /*! @brief Maximum number of relaxation iterations per load step */
+  size_t d_drMaxIter;
+
+  /*! @brief Factor multiplying the stability bound of the fictitious mass */
+  double d_drMassFactor;
+
+  /** @}*/
+
+  /**
+   * @name Stable time step of explicit schemes
+   */
+  /**@{*/
+
+  /*! @brief Safety factor applied to the estimated critical time step */
+  double d_dtSafetyFactor;
+
+  /*! @brief Flag indicating if the estimated stable time step replaces d_dt */
+  bool d_useStableDt;
+
+  /*!
+   * @brief Maximum added mass of a node relative to its physical mass
+   *
+   * If positive, nodes whose critical time step is below d_dt get their
+   * density scaled up, by at most this ratio, to reach d_dt.
+   */
+  double d_maxAddedMass;
+
+  /*!
+   * @brief Maximum time step level of the multirate scheme
+   *
+   * Nodes of level l are integrated with time step \f$ \Delta t / 2^l \f$.
+   */
+  size_t d_maxTimeLevel;
+
+  /** @}*/
+
+  /**
+   * @name Implicit dynamics
+   *
+   * Parameters of the \a newmark and \a hht_alpha schemes.
+   */
+  /**@{*/
+
+  /*! @brief Newmark parameter \f$ \beta \f$ */
+  double d_newmarkBeta;
+
+  /*! @brief Newmark parameter \f$ \gamma \f$ */
+  double d_newmarkGamma;
+
+  /*! @brief HHT parameter \f$ \alpha \in [-1/3, 0] \f$ (zero for Newmark)
+   */
+  double d_hhtAlpha;
+
+  /** @}*/
+
+  /**
+   * @name Tiled time stepping
+   *
+   * Used by the \a velocity_verlet scheme when the number of tiles is
+   * positive, see model::FDModel::integrateTiled().
+   */
+  /**@{*/
+
+  /*! @brief Number of spatial tiles (zero disables tiling) */
+  size_t d_numTiles;
+
+  /*! @brief Maximum number of time steps a tile may run ahead of the
+   * slowest tile */
+  size_t d_tileLookahead;
+
+  /*! @brief Number of time steps advanced per temporal block (values larger
+   * than one enable the wavefront scheme) */
+  size_t d_timeBlock;
+
+  /*! @brief Number of nodes in a cache block of the wavefront scheme */
+  size_t d_blockNodes;
+
+  /** @}*/
+
+  /*! @brief Flag to cut node loops into chunks of equal bond work */
+  bool d_workPartition;
+
+  /*! @brief Number of chunks per thread (zero to calibrate at startup) */
+  size_t d_chunksPerThread;
+
   /*!
    * @brief Constructor
    */
   ModelDeck()
       : d_dim(0), d_isRestartActive(false), d_tFinal(0.), d_dt(0.), d_Nt(0),
-        d_horizon(0.), d_rh(0), d_h(0.), d_RelaxN(0){};
+        d_horizon(0.), d_rh(0), d_h(0.), d_RelaxN(0), d_drTol(1.0E-6),
+        d_drMaxIter(100000), d_drMassFactor(1.), d_dtSafetyFactor(0.8),
+        d_useStableDt(false), d_maxAddedMass(0.), d_maxTimeLevel(3),
+        d_newmarkBeta(0.25), d_newmarkGamma(0.5), d_hhtAlpha(0.),
+        d_numTiles(0), d_tileLookahead(4), d_timeBlock(1),
+        d_blockNodes(20000), d_workPartition(false),
+        d_chunksPerThread(0){};
 
   /*!
    * @brief Returns the string containing information about the instance of
@@ -117,6 +225,39 @@ struct ModelDeck {
     oss << tabS << "Size time steps = " << d_dt << std::endl;
     oss << tabS << "Mesh size = " << d_h << std::endl;
     oss << tabS << "Horizon = " << d_horizon << std::endl;
+    if (d_timeDiscretization == "dynamic_relaxation") {
+      oss << tabS << "Relaxation tolerance = " << d_drTol << std::endl;
+      oss << tabS << "Relaxation max iterations = " << d_drMaxIter << std::endl;
+      oss << tabS << "Relaxation mass factor = " << d_drMassFactor
+          << std::endl;
+    }
+    if (d_simType == "explicit" and
+        d_timeDiscretization != "dynamic_relaxation") {
+      oss << tabS << "Time step safety factor = " << d_dtSafetyFactor
+          << std::endl;
+      oss << tabS << "Use stable time step = " << d_useStableDt << std::endl;
+      oss << tabS << "Maximum added mass = " << d_maxAddedMass << std::endl;
+      if (d_timeDiscretization == "multirate_verlet")
+        oss << tabS << "Maximum time step level = " << d_maxTimeLevel
+            << std::endl;
+    }
+    if (d_numTiles > 0) {
+      oss << tabS << "Number of tiles = " << d_numTiles << std::endl;
+      oss << tabS << "Tile lookahead = " << d_tileLookahead << std::endl;
+      if (d_timeBlock > 1) {
+        oss << tabS << "Time block = " << d_timeBlock << std::endl;
+        oss << tabS << "Block nodes = " << d_blockNodes << std::endl;
+      }
+    }
+    if (d_workPartition)
+      oss << tabS << "Chunks per thread = " << d_chunksPerThread
+          << (d_chunksPerThread == 0 ? " (calibrated)" : "") << std::endl;
+    if (d_timeDiscretization == "newmark" or
+        d_timeDiscretization == "hht_alpha") {
+      oss << tabS << "Newmark beta = " << d_newmarkBeta << std::endl;
+      oss << tabS << "Newmark gamma = " << d_newmarkGamma << std::endl;
+      oss << tabS << "HHT alpha = " << d_hhtAlpha << std::endl;
+    }
     oss << tabS << std::endl;
 
     return oss.str();
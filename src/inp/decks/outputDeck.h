@@ -9,6 +9,8 @@
 #ifndef INP_OUTPUTDECK_H
 #define INP_OUTPUTDECK_H
 
+#include <array>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include "util/utilIO.h"
@@ -20,6 +22,81 @@ namespace inp {
  */
 /**@{*/
 
+/*! @brief Output tags known to the models and the output writer
+ *
+ * Tags given in the input file are resolved once into a bitmask of these
+ * tags, see OutputDeck::resolveTags(), so that the hot loops test bits
+ * instead of searching the list of strings.
+ */
+enum class OutputTag : std::uint8_t {
+  Displacement = 0,
+  Velocity,
+  Force,
+  Force_Density,
+  Reaction_Force,
+  Total_Reaction_Force,
+  Strain_Energy,
+  Work_Done,
+  Fixity,
+  Node_Volume,
+  Damage_Phi,
+  Damage_Z,
+  Fracture_Perienergy_Bond,
+  Fracture_Perienergy_Total,
+  Total_Energy,
+  Total_Fracture_Perienergy_Bond,
+  Total_Fracture_Perienergy_Total,
+  Neighbors,
+  Neighbors_Crack,
+  Broken_Bonds,
+  Strain_Tensor,
+  Stress_Tensor,
+  Initial_Crack,
+  Count
+};
+
+/*!
+ * @brief Returns the bit of output tag in bitmask
+ * @param tag Output tag
+ * @return Bit Bit of tag
+ */
+inline std::uint32_t getTagBit(OutputTag tag) {
+  return std::uint32_t(1) << std::uint32_t(tag);
+}
+
+/*!
+ * @brief Returns the name of output tag as used in the input file
+ * @param tag Output tag
+ * @return Name Name of tag
+ */
+inline const std::string &getTagName(OutputTag tag) {
+  static const std::array<std::string, size_t(OutputTag::Count)> names = {
+      "Displacement",
+      "Velocity",
+      "Force",
+      "Force_Density",
+      "Reaction_Force",
+      "Total_Reaction_Force",
+      "Strain_Energy",
+      "Work_Done",
+      "Fixity",
+      "Node_Volume",
+      "Damage_Phi",
+      "Damage_Z",
+      "Fracture_Perienergy_Bond",
+      "Fracture_Perienergy_Total",
+      "Total_Energy",
+      "Total_Fracture_Perienergy_Bond",
+      "Total_Fracture_Perienergy_Total",
+      "Neighbors",
+      "Neighbors_Crack",
+      "Broken_Bonds",
+      "Strain_Tensor",
+      "Stress_Tensor",
+      "Initial_Crack"};
+  return names[size_t(tag)];
+}
+
 /*! @brief Structure to read input data for performing simulation output */
 struct OutputDeck {
 
@@ -38,6 +115,9 @@ struct OutputDeck {
   /*! @brief List of tags of data to be dumped */
   std::vector<std::string> d_outTags;
 
+  /*! @brief Bitmask of inp::OutputTag in d_outTags, see resolveTags() */
+  std::uint32_t d_outMask;
+
   /*! @brief Size of time steps (or frequency) for output operation */
   size_t d_dtOut;
 
@@ -79,12 +159,45 @@ struct OutputDeck {
   /*! @brief List of parameters required in checking output criteria */
   std::vector<double> d_outCriteriaParams;
 
+  /*!
+   * @brief Filename (without extension) of the profiling report
+   *
+   * Profiling is disabled if the filename is empty. See util::Profiler.
+   */
+  std::string d_profileFile;
+
+  /*! @brief Format of the profiling report (json or csv) */
+  std::string d_profileFormat;
+
   /*!
    * @brief Constructor
    */
   OutputDeck()
-      : d_outFormat("vtu"), d_path("./"), d_dtOut(0), d_dtOutOld(0), d_debug(0),
-        d_performFEOut(true), d_dtOutCriteria(0){};
+      : d_outFormat("vtu"), d_path("./"), d_outMask(0), d_dtOut(0),
+        d_dtOutOld(0), d_debug(0), d_performFEOut(true), d_dtOutCriteria(0),
+        d_profileFormat("json"){};
+
+  /*!
+   * @brief Resolves the list of tags into the bitmask of output tags
+   *
+   * Has to be called whenever d_outTags is changed. Tags which are not
+   * inp::OutputTag are only found by the string version of isTagInOutput().
+   */
+  void resolveTags() {
+    d_outMask = 0;
+    for (size_t i = 0; i < size_t(OutputTag::Count); i++)
+      if (isTagInOutput(getTagName(OutputTag(i))))
+        d_outMask |= getTagBit(OutputTag(i));
+  };
+
+  /*!
+   * @brief Returns true if the output tag is in the list
+   * @param tag Tag to search
+   * @return bool True if tag is in the list
+   */
+  bool isTagInOutput(OutputTag tag) const {
+    return (d_outMask & getTagBit(tag)) != 0;
+  };
 
   /*!
    * @brief Searches list of tags and returns true if the asked tag is in the
@@ -92,7 +205,7 @@ struct OutputDeck {
    * @param tag Tag to search
    * @return bool True or false If tag is find return true or else false
    */
-  bool isTagInOutput(const std::string &tag) {
+  bool isTagInOutput(const std::string &tag) const {
 
     // search for tag in output tag list
     for (const auto &type : d_outTags)
@@ -120,6 +233,9 @@ struct OutputDeck {
     oss << tabS << "Output tags = " << util::io::printStr(d_outTags) << std::endl;
     oss << tabS << "Output interval = " << d_dtOut << std::endl;
     oss << tabS << "Debug level = " << d_debug << std::endl;
+    if (!d_profileFile.empty())
+      oss << tabS << "Profile file = " << d_profileFile << "."
+          << d_profileFormat << std::endl;
     oss << tabS << std::endl;
 
     return oss.str();
@@ -24,8 +24,9 @@ struct PolicyDeck {
   /*!
    * @brief Flag which indicates level of memory control to be enforced
    *
-   * Default is 0 which means no control. Max at present is 2 which means as
-   * much control as possible.
+   * Default is 0 which means no control. Max at present is 4 which means as
+   * much control as possible: at level 4 the neighbor list is not stored and
+   * bonds are enumerated on the fly from a cell list.
    */
   int d_memControlFlag;
 
@@ -35,10 +35,110 @@ struct SolverDeck {
   /*! @brief Perturbation for the finite difference approximation in the implicit time integration */
   double d_perturbation;
 
+  /*!
+   * @brief Type of the Newton method
+   *
+   * - full: assemble the Jacobian in every iteration
+   * - modified: reuse the factorized Jacobian over several iterations
+   * - bfgs: limited-memory BFGS updates of the factorized Jacobian
+   * - broyden: limited-memory Broyden updates of the factorized Jacobian
+   */
+  std::string d_newtonType;
+
+  /*! @brief Number of iterations after which the Jacobian is reassembled
+   * (0 means only on stagnation) */
+  size_t d_refreshInterval;
+
+  /*! @brief The Jacobian is reassembled if the ratio of two consecutive
+   * residual norms is above this value */
+  double d_stagnationRatio;
+
+  /*! @brief Number of stored update pairs for BFGS and Broyden */
+  size_t d_historySize;
+
+  /*! @brief Flag to reuse the factorized Jacobian across load steps */
+  bool d_reuseAcrossSteps;
+
+  /*! @brief Flag for adaptive load increments */
+  bool d_adaptiveLoad;
+
+  /*! @brief Smallest load increment relative to the time step of the model
+   * deck */
+  double d_minStepFactor;
+
+  /*! @brief Largest load increment relative to the time step of the model
+   * deck */
+  double d_maxStepFactor;
+
+  /*! @brief Factor to increase the load increment after fast convergence */
+  double d_growthFactor;
+
+  /*! @brief Factor to reduce the load increment after a failed load step */
+  double d_cutbackFactor;
+
+  /*! @brief Load step converged within this number of iterations is
+   * considered fast */
+  size_t d_fastIterations;
+
+  /*! @brief Flag for the backtracking line search */
+  bool d_lineSearch;
+
+  /*! @brief Maximum number of backtracking steps */
+  size_t d_lineSearchMaxIters;
+
+  /*! @brief Sufficient decrease parameter of the line search */
+  double d_lineSearchDecrease;
+
+  /*!
+   * @brief Preconditioner of the Krylov solver of the full Newton method
+   *
+   * - none: unpreconditioned solver of BlazeIterative
+   * - multigrid: geometric multigrid V-cycle
+   */
+  std::string d_preconditioner;
+
+  /*! @brief Maximum number of multigrid levels */
+  size_t d_mgMaxLevels;
+
+  /*! @brief Coarsening stops once a level has at most this number of DOFs */
+  size_t d_mgCoarseSize;
+
+  /*! @brief Number of pre- and post-smoothing steps */
+  size_t d_mgSmoothingSteps;
+
+  /*! @brief Relative tolerance of the preconditioned Krylov solver */
+  double d_linearTol;
+
+  /*! @brief Maximum iterations of the preconditioned Krylov solver */
+  size_t d_linearMaxIters;
+
   /*!
    * @brief Constructor
    */
-  SolverDeck() : d_maxIters(0), d_tol(0.){};
+  SolverDeck()
+      : d_maxIters(0),
+        d_tol(0.),
+        d_perturbation(0.),
+        d_newtonType("full"),
+        d_refreshInterval(0),
+        d_stagnationRatio(0.5),
+        d_historySize(10),
+        d_reuseAcrossSteps(true),
+        d_adaptiveLoad(false),
+        d_minStepFactor(1e-3),
+        d_maxStepFactor(1.),
+        d_growthFactor(1.5),
+        d_cutbackFactor(0.5),
+        d_fastIterations(3),
+        d_lineSearch(false),
+        d_lineSearchMaxIters(10),
+        d_lineSearchDecrease(1e-4),
+        d_preconditioner("none"),
+        d_mgMaxLevels(10),
+        d_mgCoarseSize(500),
+        d_mgSmoothingSteps(2),
+        d_linearTol(1e-8),
+        d_linearMaxIters(500){};
 
   /*!
    * @brief Returns the string containing information about the instance of
@@ -57,6 +157,32 @@ struct SolverDeck {
     oss << tabS << "Max iterations = " << d_maxIters << std::endl;
     oss << tabS << "Tolerance = " << d_tol << std::endl;
     oss << tabS << "Perturbation = " << d_perturbation << std::endl;
+    oss << tabS << "Newton type = " << d_newtonType << std::endl;
+    oss << tabS << "Refresh interval = " << d_refreshInterval << std::endl;
+    oss << tabS << "Stagnation ratio = " << d_stagnationRatio << std::endl;
+    oss << tabS << "History size = " << d_historySize << std::endl;
+    oss << tabS << "Reuse across steps = " << d_reuseAcrossSteps << std::endl;
+    oss << tabS << "Adaptive load steps = " << d_adaptiveLoad << std::endl;
+    oss << tabS << "Min step factor = " << d_minStepFactor << std::endl;
+    oss << tabS << "Max step factor = " << d_maxStepFactor << std::endl;
+    oss << tabS << "Growth factor = " << d_growthFactor << std::endl;
+    oss << tabS << "Cutback factor = " << d_cutbackFactor << std::endl;
+    oss << tabS << "Fast iterations = " << d_fastIterations << std::endl;
+    oss << tabS << "Line search = " << d_lineSearch << std::endl;
+    oss << tabS << "Line search max iterations = " << d_lineSearchMaxIters
+        << std::endl;
+    oss << tabS << "Line search decrease = " << d_lineSearchDecrease
+        << std::endl;
+    oss << tabS << "Preconditioner = " << d_preconditioner << std::endl;
+    if (d_preconditioner == "multigrid") {
+      oss << tabS << "Multigrid max levels = " << d_mgMaxLevels << std::endl;
+      oss << tabS << "Multigrid coarse size = " << d_mgCoarseSize << std::endl;
+      oss << tabS << "Multigrid smoothing steps = " << d_mgSmoothingSteps
+          << std::endl;
+      oss << tabS << "Linear tolerance = " << d_linearTol << std::endl;
+      oss << tabS << "Linear max iterations = " << d_linearMaxIters
+          << std::endl;
+    }
     oss << tabS << std::endl;
 
     return oss.str();
@@ -11,8 +11,10 @@
 #include <yaml-cpp/yaml.h>
 
 #include <cmath>
+#include <fstream>
 #include <hpx/config.hpp>
 #include <iostream>
+#include <sstream>
 
 #include "decks/fractureDeck.h"
 #include "decks/initialConditionDeck.h"
@@ -36,6 +38,11 @@ static inline bool definitelyGreaterThan(const double &a, const double &b) {
          ((std::abs(a) < std::abs(b) ? std::abs(b) : std::abs(a)) * 1.0E-5);
 }
 
+static inline YAML::Node loadConfig(const std::string &filename,
+                                    const std::string &config) {
+  return config.empty() ? YAML::LoadFile(filename) : YAML::Load(config);
+}
+
 inp::Input::Input(const std::string &filename)
     : d_fractureDeck_p(nullptr),
       d_meshDeck_p(nullptr),
@@ -50,6 +57,28 @@ inp::Input::Input(const std::string &filename)
       d_solverDeck_p(nullptr) {
   d_inputFilename = filename;
 
+  readDecks();
+}
+
+inp::Input::Input(const std::string &filename, const std::string &config)
+    : d_fractureDeck_p(nullptr),
+      d_meshDeck_p(nullptr),
+      d_initialConditionDeck_p(nullptr),
+      d_interiorFlagsDeck_p(nullptr),
+      d_loadingDeck_p(nullptr),
+      d_materialDeck_p(nullptr),
+      d_neighborDeck_p(nullptr),
+      d_outputDeck_p(nullptr),
+      d_policyDeck_p(nullptr),
+      d_modelDeck_p(nullptr),
+      d_solverDeck_p(nullptr) {
+  d_inputFilename = filename;
+  d_inputConfig = config;
+
+  readDecks();
+}
+
+void inp::Input::readDecks() {
   // follow the order of reading
   setModelDeck();
   setRestartDeck();
@@ -115,12 +144,27 @@ const std::string inp::Input::getSpatialDiscretization() {
   return d_modelDeck_p->d_spatialDiscretization;
 }
 
+std::string inp::Input::getConfig() const {
+  if (!d_inputConfig.empty()) return d_inputConfig;
+
+  std::ifstream file(d_inputFilename);
+  if (!file) {
+    std::cerr << "Error: Can not read input file " << d_inputFilename
+              << ".\n";
+    exit(1);
+  }
+
+  std::ostringstream oss;
+  oss << file.rdbuf();
+  return oss.str();
+}
+
 //
 // setter methods
 //
 void inp::Input::setModelDeck() {
   d_modelDeck_p = new inp::ModelDeck();
-  YAML::Node config = YAML::LoadFile(d_inputFilename);
+  YAML::Node config = loadConfig(d_inputFilename, d_inputConfig);
 
   // read dimension
   if (config["Model"]["Dimension"])
@@ -143,9 +187,60 @@ void inp::Input::setModelDeck() {
         config["Model"]["Discretization_Type"]["Spatial"].as<std::string>();
 
   if (d_modelDeck_p->d_timeDiscretization == "central_difference" or
-      d_modelDeck_p->d_timeDiscretization == "velocity_verlet")
+      d_modelDeck_p->d_timeDiscretization == "velocity_verlet" or
+      d_modelDeck_p->d_timeDiscretization == "dynamic_relaxation" or
+      d_modelDeck_p->d_timeDiscretization == "multirate_verlet")
     d_modelDeck_p->d_simType = "explicit";
 
+  // read dynamic relaxation parameters
+  if (config["Model"]["Dynamic_Relaxation"]) {
+    auto e = config["Model"]["Dynamic_Relaxation"];
+    if (e["Tolerance"])
+      d_modelDeck_p->d_drTol = e["Tolerance"].as<double>();
+    if (e["Max_Iterations"])
+      d_modelDeck_p->d_drMaxIter = e["Max_Iterations"].as<size_t>();
+    if (e["Mass_Factor"])
+      d_modelDeck_p->d_drMassFactor = e["Mass_Factor"].as<double>();
+
+    if (d_modelDeck_p->d_drTol <= 0. or d_modelDeck_p->d_drMassFactor < 1.) {
+      std::cerr << "Error: Dynamic relaxation requires Tolerance > 0 and "
+                   "Mass_Factor >= 1.\n";
+      exit(1);
+    }
+  }
+
+  if (d_modelDeck_p->d_timeDiscretization == "newmark" or
+      d_modelDeck_p->d_timeDiscretization == "hht_alpha")
+    d_modelDeck_p->d_simType = "implicit";
+
+  // read parameters of the implicit dynamic schemes
+  if (config["Model"]["Newmark"]) {
+    auto e = config["Model"]["Newmark"];
+    if (e["Beta"]) d_modelDeck_p->d_newmarkBeta = e["Beta"].as<double>();
+    if (e["Gamma"]) d_modelDeck_p->d_newmarkGamma = e["Gamma"].as<double>();
+    if (e["Alpha"]) d_modelDeck_p->d_hhtAlpha = e["Alpha"].as<double>();
+  }
+
+  if (d_modelDeck_p->d_timeDiscretization == "hht_alpha") {
+    if (!config["Model"]["Newmark"]["Alpha"]) d_modelDeck_p->d_hhtAlpha = -0.05;
+
+    if (d_modelDeck_p->d_hhtAlpha < -1. / 3. or d_modelDeck_p->d_hhtAlpha > 0.) {
+      std::cerr << "Error: HHT parameter Alpha has to be in [-1/3, 0].\n";
+      exit(1);
+    }
+
+    // unconditionally stable and second order accurate choice
+    d_modelDeck_p->d_newmarkBeta =
+        0.25 * std::pow(1. - d_modelDeck_p->d_hhtAlpha, 2);
+    d_modelDeck_p->d_newmarkGamma = 0.5 - d_modelDeck_p->d_hhtAlpha;
+  } else
+    d_modelDeck_p->d_hhtAlpha = 0.;
+
+  if (d_modelDeck_p->d_newmarkBeta <= 0.) {
+    std::cerr << "Error: Newmark parameter Beta has to be positive.\n";
+    exit(1);
+  }
+
   // read horizon and horizon to mesh ratio (if available)
   if (config["Model"]["Horizon"])
     d_modelDeck_p->d_horizon = config["Model"]["Horizon"].as<double>();
@@ -183,13 +278,83 @@ void inp::Input::setModelDeck() {
 
   d_modelDeck_p->d_dt = d_modelDeck_p->d_tFinal / d_modelDeck_p->d_Nt;
 
+  // read stable time step parameters
+  if (config["Model"]["Stable_Time_Step"]) {
+    auto e = config["Model"]["Stable_Time_Step"];
+    if (e["Safety_Factor"])
+      d_modelDeck_p->d_dtSafetyFactor = e["Safety_Factor"].as<double>();
+    if (e["Use_Estimate"])
+      d_modelDeck_p->d_useStableDt = e["Use_Estimate"].as<bool>();
+    if (e["Max_Added_Mass"])
+      d_modelDeck_p->d_maxAddedMass = e["Max_Added_Mass"].as<double>();
+
+    if (d_modelDeck_p->d_dtSafetyFactor <= 0. or
+        d_modelDeck_p->d_dtSafetyFactor > 1. or
+        d_modelDeck_p->d_maxAddedMass < 0.) {
+      std::cerr << "Error: Stable_Time_Step requires 0 < Safety_Factor <= 1 "
+                   "and Max_Added_Mass >= 0.\n";
+      exit(1);
+    }
+  }
+
+  // read multirate parameters
+  if (config["Model"]["Multirate"]) {
+    if (config["Model"]["Multirate"]["Max_Level"])
+      d_modelDeck_p->d_maxTimeLevel =
+          config["Model"]["Multirate"]["Max_Level"].as<size_t>();
+
+    if (d_modelDeck_p->d_maxTimeLevel > 10) {
+      std::cerr << "Error: Multirate Max_Level should not be larger than 10."
+                   "\n";
+      exit(1);
+    }
+  }
+
+  // read tiling parameters
+  if (config["Model"]["Tiling"]) {
+    auto e = config["Model"]["Tiling"];
+    if (e["Tiles"]) d_modelDeck_p->d_numTiles = e["Tiles"].as<size_t>();
+    if (e["Lookahead"])
+      d_modelDeck_p->d_tileLookahead = e["Lookahead"].as<size_t>();
+    if (e["Time_Block"])
+      d_modelDeck_p->d_timeBlock = e["Time_Block"].as<size_t>();
+    if (e["Block_Nodes"])
+      d_modelDeck_p->d_blockNodes = e["Block_Nodes"].as<size_t>();
+
+    if (d_modelDeck_p->d_numTiles > 0 and
+        d_modelDeck_p->d_timeDiscretization != "velocity_verlet") {
+      std::cerr << "Error: Tiling requires time discretization "
+                   "velocity_verlet.\n";
+      exit(1);
+    }
+
+    if (d_modelDeck_p->d_tileLookahead == 0) {
+      std::cerr << "Error: Tiling Lookahead has to be positive.\n";
+      exit(1);
+    }
+
+    if (d_modelDeck_p->d_timeBlock == 0 or d_modelDeck_p->d_blockNodes == 0) {
+      std::cerr << "Error: Tiling Time_Block and Block_Nodes have to be "
+                   "positive.\n";
+      exit(1);
+    }
+  }
+
+  // read work partitioning of node loops
+  if (config["Model"]["Work_Partition"]) {
+    d_modelDeck_p->d_workPartition = true;
+    auto e = config["Model"]["Work_Partition"];
+    if (e["Chunks_Per_Thread"])
+      d_modelDeck_p->d_chunksPerThread = e["Chunks_Per_Thread"].as<size_t>();
+  }
+
   // check if this is restart problem
   if (config["Restart"]) d_modelDeck_p->d_isRestartActive = true;
 }  // setModelDeck
 
 void inp::Input::setRestartDeck() {
   d_restartDeck_p = new inp::RestartDeck();
-  YAML::Node config = YAML::LoadFile(d_inputFilename);
+  YAML::Node config = loadConfig(d_inputFilename, d_inputConfig);
 
   // read restart file
   if (config["Restart"]) {
@@ -213,7 +378,7 @@ void inp::Input::setRestartDeck() {
 
 void inp::Input::setMeshDeck() {
   d_meshDeck_p = new inp::MeshDeck();
-  YAML::Node config = YAML::LoadFile(d_inputFilename);
+  YAML::Node config = loadConfig(d_inputFilename, d_inputConfig);
 
   // read dimension
   if (config["Model"]["Dimension"])
@@ -259,7 +424,7 @@ void inp::Input::setMeshDeck() {
 
 void inp::Input::setMassMatrixDeck() {
   d_massMatrixDeck_p = new inp::MassMatrixDeck();
-  YAML::Node config = YAML::LoadFile(d_inputFilename);
+  YAML::Node config = loadConfig(d_inputFilename, d_inputConfig);
 
   // read fem related parameters
   if (config["Mesh"]["FEM_Info"]["M_Matrix_Approx"])
@@ -269,7 +434,7 @@ void inp::Input::setMassMatrixDeck() {
 
 void inp::Input::setQuadratureDeck() {
   d_quadratureDeck_p = new inp::QuadratureDeck();
-  YAML::Node config = YAML::LoadFile(d_inputFilename);
+  YAML::Node config = loadConfig(d_inputFilename, d_inputConfig);
 
   if (config["Mesh"]["FEM_Info"]["Order_Quad_Int"])
     d_quadratureDeck_p->d_quadOrder =
@@ -281,7 +446,7 @@ void inp::Input::setQuadratureDeck() {
 
 void inp::Input::setNeighborDeck() {
   d_neighborDeck_p = new inp::NeighborDeck();
-  YAML::Node config = YAML::LoadFile(d_inputFilename);
+  YAML::Node config = loadConfig(d_inputFilename, d_inputConfig);
 
   if (config["Neighbor"]["Safety_Factor"])
     d_neighborDeck_p->d_safetyFactor =
@@ -294,7 +459,7 @@ void inp::Input::setNeighborDeck() {
 
 void inp::Input::setFractureDeck() {
   d_fractureDeck_p = new inp::FractureDeck();
-  YAML::Node config = YAML::LoadFile(d_inputFilename);
+  YAML::Node config = loadConfig(d_inputFilename, d_inputConfig);
 
   size_t ncracks = 0;
   if (config["Fracture"]["Cracks"]["Sets"])
@@ -361,7 +526,7 @@ void inp::Input::setFractureDeck() {
 
 void inp::Input::setInteriorFlagsDeck() {
   d_interiorFlagsDeck_p = new inp::InteriorFlagsDeck();
-  YAML::Node config = YAML::LoadFile(d_inputFilename);
+  YAML::Node config = loadConfig(d_inputFilename, d_inputConfig);
 
   if (config["No_Fail_Region"]) {
     auto e = config["No_Fail_Region"];
@@ -407,7 +572,7 @@ void inp::Input::setInteriorFlagsDeck() {
 
 void inp::Input::setInitialConditionDeck() {
   d_initialConditionDeck_p = new inp::InitialConditionDeck();
-  YAML::Node config = YAML::LoadFile(d_inputFilename);
+  YAML::Node config = loadConfig(d_inputFilename, d_inputConfig);
 
   if (config["Initial_Condition"]["Displacement"]) {
     auto e = config["Initial_Condition"]["Displacement"];
@@ -442,7 +607,7 @@ void inp::Input::setInitialConditionDeck() {
 
 void inp::Input::setLoadingDeck() {
   d_loadingDeck_p = new inp::LoadingDeck();
-  YAML::Node config = YAML::LoadFile(d_inputFilename);
+  YAML::Node config = loadConfig(d_inputFilename, d_inputConfig);
 
   // since displacement bc and force bc are of same nature, we combine the
   // reading of both
@@ -618,7 +783,7 @@ void inp::Input::setLoadingDeck() {
 
 void inp::Input::setMaterialDeck() {
   d_materialDeck_p = new inp::MaterialDeck();
-  YAML::Node config = YAML::LoadFile(d_inputFilename);
+  YAML::Node config = loadConfig(d_inputFilename, d_inputConfig);
 
   auto e = config["Material"];
   if (e["Is_Plane_Strain"])
@@ -728,7 +893,7 @@ void inp::Input::setMaterialDeck() {
 
 void inp::Input::setOutputDeck() {
   d_outputDeck_p = new inp::OutputDeck();
-  YAML::Node config = YAML::LoadFile(d_inputFilename);
+  YAML::Node config = loadConfig(d_inputFilename, d_inputConfig);
 
   if (config["Output"]) {
     auto e = config["Output"];
@@ -738,6 +903,7 @@ void inp::Input::setOutputDeck() {
     if (e["Tags"])
       for (auto f : e["Tags"])
         d_outputDeck_p->d_outTags.push_back(f.as<std::string>());
+    d_outputDeck_p->resolveTags();
 
     if (e["Output_Interval"])
       d_outputDeck_p->d_dtOut = e["Output_Interval"].as<size_t>();
@@ -761,12 +927,22 @@ void inp::Input::setOutputDeck() {
           d_outputDeck_p->d_outCriteriaParams.emplace_back(p.as<double>());
       }
     }
+    if (e["Profile"]) {
+      if (e["Profile"]["File"])
+        d_outputDeck_p->d_profileFile =
+            d_outputDeck_p->d_path + e["Profile"]["File"].as<std::string>();
+      else
+        d_outputDeck_p->d_profileFile = d_outputDeck_p->d_path + "profile";
+      if (e["Profile"]["Format"])
+        d_outputDeck_p->d_profileFormat =
+            e["Profile"]["Format"].as<std::string>();
+    }
   }
 }  // setOutputDeck
 
 void inp::Input::setPolicyDeck() {
   d_policyDeck_p = new inp::PolicyDeck();
-  YAML::Node config = YAML::LoadFile(d_inputFilename);
+  YAML::Node config = loadConfig(d_inputFilename, d_inputConfig);
 
   if (config["Policy"]["Memory_Consumption_Flag"])
     d_policyDeck_p->d_memControlFlag =
@@ -778,7 +954,7 @@ void inp::Input::setPolicyDeck() {
 
 void inp::Input::setSolverDeck() {
   d_solverDeck_p = new inp::SolverDeck();
-  YAML::Node config = YAML::LoadFile(d_inputFilename);
+  YAML::Node config = loadConfig(d_inputFilename, d_inputConfig);
 
   if (config["Solver"]) {
     auto e = config["Solver"];
@@ -788,12 +964,103 @@ void inp::Input::setSolverDeck() {
     if (e["Tolerance"]) d_solverDeck_p->d_tol = e["Tolerance"].as<double>();
     if (e["Perturbation"])
       d_solverDeck_p->d_perturbation = e["Perturbation"].as<double>();
+
+    if (e["Newton"]) {
+      auto f = e["Newton"];
+      if (f["Type"]) d_solverDeck_p->d_newtonType = f["Type"].as<std::string>();
+      if (f["Refresh_Interval"])
+        d_solverDeck_p->d_refreshInterval = f["Refresh_Interval"].as<size_t>();
+      if (f["Stagnation_Ratio"])
+        d_solverDeck_p->d_stagnationRatio = f["Stagnation_Ratio"].as<double>();
+      if (f["History_Size"])
+        d_solverDeck_p->d_historySize = f["History_Size"].as<size_t>();
+      if (f["Reuse_Across_Steps"])
+        d_solverDeck_p->d_reuseAcrossSteps = f["Reuse_Across_Steps"].as<bool>();
+    }
+
+    if (e["Load_Stepping"]) {
+      auto f = e["Load_Stepping"];
+      if (f["Adaptive"])
+        d_solverDeck_p->d_adaptiveLoad = f["Adaptive"].as<bool>();
+      if (f["Min_Step_Factor"])
+        d_solverDeck_p->d_minStepFactor = f["Min_Step_Factor"].as<double>();
+      if (f["Max_Step_Factor"])
+        d_solverDeck_p->d_maxStepFactor = f["Max_Step_Factor"].as<double>();
+      if (f["Growth_Factor"])
+        d_solverDeck_p->d_growthFactor = f["Growth_Factor"].as<double>();
+      if (f["Cutback_Factor"])
+        d_solverDeck_p->d_cutbackFactor = f["Cutback_Factor"].as<double>();
+      if (f["Fast_Iterations"])
+        d_solverDeck_p->d_fastIterations = f["Fast_Iterations"].as<size_t>();
+    }
+
+    if (e["Line_Search"]) {
+      auto f = e["Line_Search"];
+      if (f["Enabled"]) d_solverDeck_p->d_lineSearch = f["Enabled"].as<bool>();
+      if (f["Max_Iterations"])
+        d_solverDeck_p->d_lineSearchMaxIters = f["Max_Iterations"].as<size_t>();
+      if (f["Sufficient_Decrease"])
+        d_solverDeck_p->d_lineSearchDecrease =
+            f["Sufficient_Decrease"].as<double>();
+    }
+
+    if (e["Preconditioner"]) {
+      auto f = e["Preconditioner"];
+      if (f["Type"])
+        d_solverDeck_p->d_preconditioner = f["Type"].as<std::string>();
+      if (f["Max_Levels"])
+        d_solverDeck_p->d_mgMaxLevels = f["Max_Levels"].as<size_t>();
+      if (f["Coarse_Size"])
+        d_solverDeck_p->d_mgCoarseSize = f["Coarse_Size"].as<size_t>();
+      if (f["Smoothing_Steps"])
+        d_solverDeck_p->d_mgSmoothingSteps = f["Smoothing_Steps"].as<size_t>();
+      if (f["Tolerance"])
+        d_solverDeck_p->d_linearTol = f["Tolerance"].as<double>();
+      if (f["Max_Iterations"])
+        d_solverDeck_p->d_linearMaxIters = f["Max_Iterations"].as<size_t>();
+    }
+
+    if (d_solverDeck_p->d_preconditioner != "none" and
+        d_solverDeck_p->d_preconditioner != "multigrid") {
+      std::cerr << "Error: Preconditioner " << d_solverDeck_p->d_preconditioner
+                << " is not supported. Use none or multigrid.\n";
+      exit(1);
+    }
+
+    if (d_solverDeck_p->d_preconditioner == "multigrid" and
+        d_solverDeck_p->d_newtonType != "full") {
+      std::cerr << "Error: Preconditioner multigrid is only supported for "
+                   "Newton type full.\n";
+      exit(1);
+    }
+
+    if (d_solverDeck_p->d_mgMaxLevels < 1 or
+        d_solverDeck_p->d_mgCoarseSize < 1) {
+      std::cerr << "Error: Multigrid requires Max_Levels >= 1 and "
+                   "Coarse_Size >= 1.\n";
+      exit(1);
+    }
+
+    if (d_solverDeck_p->d_cutbackFactor <= 0. or
+        d_solverDeck_p->d_cutbackFactor >= 1.) {
+      std::cerr << "Error: Cutback_Factor should be in (0,1).\n";
+      exit(1);
+    }
+
+    if (d_solverDeck_p->d_newtonType != "full" and
+        d_solverDeck_p->d_newtonType != "modified" and
+        d_solverDeck_p->d_newtonType != "bfgs" and
+        d_solverDeck_p->d_newtonType != "broyden") {
+      std::cerr << "Error: Newton type " << d_solverDeck_p->d_newtonType
+                << " is not supported. Use full, modified, bfgs, or broyden.\n";
+      exit(1);
+    }
   }
 }  // setSolverDeck
 
 void inp::Input::setAbsorbingCondDeck() {
   d_absorbingCondDeck_p = new inp::AbsorbingCondDeck();
-  YAML::Node config = YAML::LoadFile(d_inputFilename);
+  YAML::Node config = loadConfig(d_inputFilename, d_inputConfig);
 
   auto ci = config["Absorbing_Condition"];
   if (!ci) return;
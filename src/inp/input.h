@@ -69,6 +69,17 @@ public:
    */
   explicit Input(const std::string &filename);
 
+  /*!
+   * @brief Constructor
+   *
+   * Reads the decks from the given YAML content instead of the file, e.g.
+   * for members of an ensemble which modify the input file.
+   *
+   * @param filename Filename of input file the content is derived from
+   * @param config YAML content of the input
+   */
+  Input(const std::string &filename, const std::string &config);
+
   /**
    * @name Accessor methods
    */
@@ -178,6 +189,23 @@ public:
    */
   const std::string getSpatialDiscretization();
 
+  /*!
+   * @brief Get the YAML content of the input
+   *
+   * Used to send the input to other localities, which may not have access
+   * to the input file.
+   *
+   * @return string Content given to the constructor or read from the input
+   * file
+   */
+  std::string getConfig() const;
+
+  /*!
+   * @brief Get the filename of the input file
+   * @return string Filename
+   */
+  const std::string &getFilename() const { return d_inputFilename; }
+
   /** @}*/
 
   /*!
@@ -208,6 +236,11 @@ private:
    */
   /**@{*/
 
+  /*!
+   * @brief Reads all decks
+   */
+  void readDecks();
+
   /*!
    * @brief Read data into fracture deck and store its pointer
    */
@@ -293,6 +326,9 @@ private:
   /*! @brief Name of input file */
   std::string d_inputFilename;
 
+  /*! @brief YAML content of the input, if empty the input file is read */
+  std::string d_inputConfig;
+
   /** @}*/
 
   /**
@@ -28,7 +28,10 @@ inp::Policy *inp::Policy::getInstance(inp::PolicyDeck *deck) {
   return d_instance_p;
 }
 
-void inp::Policy::destroyInstance() { delete[] d_instance_p; }
+void inp::Policy::destroyInstance() {
+  delete d_instance_p;
+  d_instance_p = nullptr;
+}
 
 inp::Policy::~Policy() = default;
 
@@ -36,7 +39,8 @@ inp::Policy::Policy(inp::PolicyDeck *deck)
     : d_enablePostProcessing(true),
       d_memControlFlag(0),
       d_modelTag("Model"),
-      d_maxLevel(0) {
+      d_maxLevel(0),
+      d_dataMask(0) {
   if (deck != nullptr) {
     d_enablePostProcessing = deck->d_enablePostProcessing;
     d_memControlFlag = deck->d_memControlFlag;
@@ -46,7 +50,7 @@ inp::Policy::Policy(inp::PolicyDeck *deck)
 
 void inp::Policy::init() {
   if (d_modelTag == "Model") {
-    d_maxLevel = 3;
+    d_maxLevel = 4;
     if (d_lTags.empty()) {
       d_lTags.resize(d_maxLevel + 1);
 
@@ -68,13 +72,28 @@ void inp::Policy::init() {
       // level 3 tags
       d_lTags[3] = d_lTags[2];
       d_lTags[3].emplace_back("Model_d_Z");
+
+      // level 4 tags: bonds are enumerated on the fly instead of stored
+      d_lTags[4] = d_lTags[3];
+      d_lTags[4].emplace_back("Neighbor_d_list");
     }
   }
+
+  updateDataMask();
+}
+
+void inp::Policy::updateDataMask() {
+  d_dataMask = 0;
+  for (size_t i = 0; i < size_t(PolicyTag::Count); i++)
+    if (populateData(getTagName(PolicyTag(i))))
+      d_dataMask |= getTagBit(PolicyTag(i));
 }
 
 void inp::Policy::addToTags(const size_t &level, const std::string &tag) {
   if (level >= 0 && level <= d_maxLevel)
     for (size_t i = level; i <= d_maxLevel; i++) addTag(d_lTags[i], tag);
+
+  updateDataMask();
 }
 
 void inp::Policy::removeTag(const std::string &tag) {
@@ -85,6 +104,8 @@ void inp::Policy::removeTag(const std::string &tag) {
     temp.emplace_back(s);
   }
   d_lTags[d_memControlFlag] = temp;
+
+  updateDataMask();
 }
 
 bool inp::Policy::populateData(const std::string &tag) {
@@ -9,6 +9,8 @@
 #ifndef INP_POLICY_H
 #define INP_POLICY_H
 
+#include <array>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -19,6 +21,54 @@ struct PolicyDeck;
 
 namespace inp {
 
+/*! @brief Tags of data controlled by inp::Policy
+ *
+ * Models resolve the tags once into a bitmask, see
+ * inp::Policy::getDataMask(), and test bits in their loops.
+ */
+enum class PolicyTag : std::uint8_t {
+  Model_d_e = 0,
+  Model_d_w,
+  Model_d_phi,
+  Model_d_strain,
+  Model_d_stress,
+  Model_d_eF,
+  Model_d_eFB,
+  Model_d_Z,
+  Mesh_d_vol,
+  Neighbor_d_list,
+  Count
+};
+
+/*!
+ * @brief Returns the bit of policy tag in bitmask
+ * @param tag Policy tag
+ * @return Bit Bit of tag
+ */
+inline std::uint32_t getTagBit(PolicyTag tag) {
+  return std::uint32_t(1) << std::uint32_t(tag);
+}
+
+/*!
+ * @brief Returns the name of policy tag as used in tag lists of inp::Policy
+ * @param tag Policy tag
+ * @return Name Name of tag
+ */
+inline const std::string &getTagName(PolicyTag tag) {
+  static const std::array<std::string, size_t(PolicyTag::Count)> names = {
+      "Model_d_e",
+      "Model_d_w",
+      "Model_d_phi",
+      "Model_d_strain",
+      "Model_d_stress",
+      "Model_d_eF",
+      "Model_d_eFB",
+      "Model_d_Z",
+      "Mesh_d_vol",
+      "Neighbor_d_list"};
+  return names[size_t(tag)];
+}
+
 /*! @brief A class to enforce certain policies to reduce memory loads
  *
  * We implement simple method to control population of data in simulation.
@@ -26,7 +76,7 @@ namespace inp {
  * assigning a tag to d_modelTag and defining a new rule for the tag in the
  * inp::Policy::init.
  *
- * For a given memory control flag i (can be 0,1,2,3), we look at the list of
+ * For a given memory control flag i (can be 0 to 4), we look at the list of
  * tags in inp::Policy::d_lTags to know whether we populate the data (given
  * by tag, e.g. tag for data d_u in model::Model is Model_g_u) in the
  * simulation. If it is in the list inp::Policy::d_lTags[i] then we do not
@@ -92,6 +142,25 @@ public:
    */
   bool populateData(const std::string &tag);
 
+  /*!
+   * @brief Returns true/false depending on whether tag is found
+   * @param tag Tag to search for
+   * @return bool True if it can be populated, false otherwise
+   */
+  bool populateData(PolicyTag tag) const {
+    return (d_dataMask & getTagBit(tag)) != 0;
+  }
+
+  /*!
+   * @brief Returns the bitmask of policy tags whose data can be populated
+   *
+   * The bitmask is resolved whenever the tag lists change, so that models
+   * can copy it once after they have adjusted the tags.
+   *
+   * @return Mask Bitmask of inp::PolicyTag
+   */
+  std::uint32_t getDataMask() const { return d_dataMask; }
+
   /*!
    * @brief Returns memory control flag
    * @return Flag
@@ -128,13 +197,16 @@ private:
   /*! @brief Initializes the data */
   void init();
 
+  /*! @brief Resolves d_dataMask from the tag list of current level */
+  void updateDataMask();
+
   /*! @brief Static instance of Policy class */
   static Policy *d_instance_p;
 
   /*!
    * @brief Flag which indicates level of memory control to be enforced
    *
-   * Default is 0 which means no control. Max at present is 2 which means as
+   * Default is 0 which means no control. Max at present is 4 which means as
    * much control as possible.
    */
   int d_memControlFlag;
@@ -156,6 +228,9 @@ private:
    * memory control
    */
   std::vector<std::vector<std::string>> d_lTags;
+
+  /*! @brief Bitmask of inp::PolicyTag not in tag list of current level */
+  std::uint32_t d_dataMask;
 };
 
 } // namespace inp
@@ -11,6 +11,7 @@
 #include "../inp/decks/loadingDeck.h"
 #include "fe/mesh.h"
 #include "util/compare.h"
+#include "util/profiler.h"
 #include "util/utilFunction.h"
 #include "util/utilGeom.h"
 #include "util/utilIO.h"
@@ -119,172 +120,185 @@ loading::FLoading::FLoading(inp::LoadingDeck *deck, fe::Mesh *mesh) {
 
 void loading::FLoading::apply(const double &time, std::vector<util::Point3> *f,
                               fe::Mesh *mesh) {
-  for (size_t s = 0; s < d_bcData.size(); s++) {
-    inp::BCData bc = d_bcData[s];
+  util::ScopedTimer timer(util::Phase::Loading);
 
-    for (auto i : d_bcNodes[s]) {
-      util::Point3 x = mesh->getNode(i);
-      double fmax = 1.0;
+  for (size_t s = 0; s < d_bcData.size(); s++)
+    for (auto i : d_bcNodes[s]) applyNode(time, s, i, f, mesh);
+}
 
-      // load the fporce from coupling
-      if (bc.d_regionType == "force_from_pum") {
-        fmax = mesh->getPrescribedValues()[i][bc.d_direction[0] - 1] /
-               mesh->getNodalVolume(i);
-      }
+void loading::FLoading::apply(
+    const double &time, std::vector<util::Point3> *f, fe::Mesh *mesh,
+    const std::vector<std::pair<size_t, size_t>> &nodes) {
+  util::ScopedTimer timer(util::Phase::Loading);
+
+  for (const auto &n : nodes) applyNode(time, n.first, n.second, f, mesh);
+}
+
+void loading::FLoading::applyNode(const double &time, const size_t &s,
+                                  const size_t &i, std::vector<util::Point3> *f,
+                                  fe::Mesh *mesh) {
+  const auto &bc = d_bcData[s];
 
-      // apply spatial function
-      if (bc.d_spatialFnType == "hat_x") {
-        // Hat function
-        //
-        //     f ^
-        //       |
-        //       |
-        // f_max o
-        //       |           /|\
-        //       |         /  |  \
-        //       |       /    |    \
-        //       |     /      |      \
-        //       |   /        |        \
-        //       | /          |          \
+  util::Point3 x = mesh->getNode(i);
+  double fmax = 1.0;
+
+  // load the fporce from coupling
+  if (bc.d_regionType == "force_from_pum") {
+    fmax = mesh->getPrescribedValues()[i][bc.d_direction[0] - 1] /
+           mesh->getNodalVolume(i);
+  }
+
+  // apply spatial function
+  if (bc.d_spatialFnType == "hat_x") {
+    // Hat function
+    //
+    //     f ^
+    //       |
+    //       |
+    // f_max o
+    //       |           /|\
+    //       |         /  |  \
+    //       |       /    |    \
+    //       |     /      |      \
+    //       |   /        |        \
+    //       | /          |          \
 	      //       o____________o____________o______\ x
-        //                                        /
-        //    loc_x_min                 loc_x_max
-        //
-        fmax = bc.d_spatialFnParams[0] *
-               util::function::hatFunction(x.d_x, bc.d_x1, bc.d_x2);
-      } else if (bc.d_spatialFnType == "hat_y") {
-        fmax = bc.d_spatialFnParams[0] *
-               util::function::hatFunction(x.d_y, bc.d_y1, bc.d_y2);
-      } else if (bc.d_spatialFnType == "hat_z") {
-        fmax = bc.d_spatialFnParams[0] *
-               util::function::hatFunction(x.d_z, bc.d_z1, bc.d_z2);
-      } else if (bc.d_spatialFnType == "sin_x") {
-        double a = M_PI * bc.d_spatialFnParams[0];
-        fmax = bc.d_spatialFnParams[0] * std::sin(a * x.d_x);
-      } else if (bc.d_spatialFnType == "sin_y") {
-        double a = M_PI * bc.d_spatialFnParams[0];
-        fmax = bc.d_spatialFnParams[0] * std::sin(a * x.d_y);
-      } else if (bc.d_spatialFnType == "sin_z") {
-        double a = M_PI * bc.d_spatialFnParams[0];
-        fmax = bc.d_spatialFnParams[0] * std::sin(a * x.d_z);
-      } else if (bc.d_spatialFnType == "linear_x") {
-        double a = bc.d_spatialFnParams[0];
-        fmax = bc.d_spatialFnParams[0] * a * x.d_x;
-      } else if (bc.d_spatialFnType == "linear_y") {
-        double a = bc.d_spatialFnParams[0];
-        fmax = bc.d_spatialFnParams[0] * a * x.d_y;
-      } else if (bc.d_spatialFnType == "linear_z") {
-        double a = bc.d_spatialFnParams[0];
-        fmax = bc.d_spatialFnParams[0] * a * x.d_z;
-      } else if (bc.d_spatialFnType == "constant") {
-        fmax = bc.d_spatialFnParams[0];
-      } else if (bc.d_spatialFnType == "line_load") {
-        double h = mesh->getMeshSize();
-
-        if (bc.d_direction.size() != 1)
-          std::cerr << "Error: This load needs to be applied to each direction "
-                       "separated!"
-                    << std::endl;
-
-        for (auto d : bc.d_direction) {
-          switch (d) {
-            case 1: {
-              double min = bc.d_x1;
-              double max = bc.d_x2;
-
-              if (bc.d_spatialFnParams[0] == -1) {
-                double max = bc.d_x1;
-                double min = bc.d_x2;
-              }
-
-              double length = std::abs(max - min);
-              size_t nodes = length / h;
-              double scale = 1. / nodes;
-
-              size_t pos = (x.d_x - min) / h;
-
-              if (bc.d_spatialFnParams[0] == -1) pos = (max - x.d_x) / h;
-
-              fmax *= pos * scale;
-
-            } break;
-            case 2: {
-              double min = bc.d_y1;
-              double max = bc.d_y2;
-
-              if (bc.d_spatialFnParams[0] == -1) {
-                double max = bc.d_y1;
-                double min = bc.d_y2;
-              }
-
-              double length = std::abs(max - min);
-              size_t nodes = length / h;
-              double scale = 1. / nodes;
-
-              size_t pos = (x.d_y - min) / h;
-
-              if (bc.d_spatialFnParams[0] == -1) pos = (max - x.d_y) / h;
-
-              fmax *= pos * scale;
-
-            } break;
-            case 3: {
-              double min = bc.d_z1;
-              double max = bc.d_z2;
-
-              if (bc.d_spatialFnParams[0] == -1) {
-                double max = bc.d_z1;
-                double min = bc.d_z2;
-              }
-
-              double length = std::abs(max - min);
-              size_t nodes = length / h;
-              double scale = 1. / nodes;
-
-              size_t pos = (x.d_z - min) / h;
-
-              if (bc.d_spatialFnParams[0] == -1) pos = (max - x.d_z) / h;
-
-              fmax *= pos * scale;
-
-            } break;
-
-            default:
-              std::cerr << "Invalid dimension" << std::endl;
-              break;
+    //                                        /
+    //    loc_x_min                 loc_x_max
+    //
+    fmax = bc.d_spatialFnParams[0] *
+           util::function::hatFunction(x.d_x, bc.d_x1, bc.d_x2);
+  } else if (bc.d_spatialFnType == "hat_y") {
+    fmax = bc.d_spatialFnParams[0] *
+           util::function::hatFunction(x.d_y, bc.d_y1, bc.d_y2);
+  } else if (bc.d_spatialFnType == "hat_z") {
+    fmax = bc.d_spatialFnParams[0] *
+           util::function::hatFunction(x.d_z, bc.d_z1, bc.d_z2);
+  } else if (bc.d_spatialFnType == "sin_x") {
+    double a = M_PI * bc.d_spatialFnParams[0];
+    fmax = bc.d_spatialFnParams[0] * std::sin(a * x.d_x);
+  } else if (bc.d_spatialFnType == "sin_y") {
+    double a = M_PI * bc.d_spatialFnParams[0];
+    fmax = bc.d_spatialFnParams[0] * std::sin(a * x.d_y);
+  } else if (bc.d_spatialFnType == "sin_z") {
+    double a = M_PI * bc.d_spatialFnParams[0];
+    fmax = bc.d_spatialFnParams[0] * std::sin(a * x.d_z);
+  } else if (bc.d_spatialFnType == "linear_x") {
+    double a = bc.d_spatialFnParams[0];
+    fmax = bc.d_spatialFnParams[0] * a * x.d_x;
+  } else if (bc.d_spatialFnType == "linear_y") {
+    double a = bc.d_spatialFnParams[0];
+    fmax = bc.d_spatialFnParams[0] * a * x.d_y;
+  } else if (bc.d_spatialFnType == "linear_z") {
+    double a = bc.d_spatialFnParams[0];
+    fmax = bc.d_spatialFnParams[0] * a * x.d_z;
+  } else if (bc.d_spatialFnType == "constant") {
+    fmax = bc.d_spatialFnParams[0];
+  } else if (bc.d_spatialFnType == "line_load") {
+    double h = mesh->getMeshSize();
+
+    if (bc.d_direction.size() != 1)
+      std::cerr << "Error: This load needs to be applied to each direction "
+                   "separated!"
+                << std::endl;
+
+    for (auto d : bc.d_direction) {
+      switch (d) {
+        case 1: {
+          double min = bc.d_x1;
+          double max = bc.d_x2;
+
+          if (bc.d_spatialFnParams[0] == -1) {
+            double max = bc.d_x1;
+            double min = bc.d_x2;
           }
-        }
-      }
 
-      // apply time function
-      if (bc.d_timeFnType == "linear")
-        fmax *= time;
-      else if (bc.d_timeFnType == "linear_step")
-        fmax *= util::function::linearStepFunc(time, bc.d_timeFnParams[1],
-                                               bc.d_timeFnParams[2]);
-      else if (bc.d_timeFnType == "linear_slow_fast") {
-        if (util::compare::definitelyGreaterThan(time, bc.d_timeFnParams[1]))
-          fmax *= bc.d_timeFnParams[3] * time;
-        else
-          fmax *= bc.d_timeFnParams[2] * time;
-      } else if (bc.d_timeFnType == "sin") {
-        double a = M_PI * bc.d_timeFnParams[1];
-        fmax *= std::sin(a * time);
-      }
+          double length = std::abs(max - min);
+          size_t nodes = length / h;
+          double scale = 1. / nodes;
+
+          size_t pos = (x.d_x - min) / h;
+
+          if (bc.d_spatialFnParams[0] == -1) pos = (max - x.d_x) / h;
+
+          fmax *= pos * scale;
+
+        } break;
+        case 2: {
+          double min = bc.d_y1;
+          double max = bc.d_y2;
+
+          if (bc.d_spatialFnParams[0] == -1) {
+            double max = bc.d_y1;
+            double min = bc.d_y2;
+          }
+
+          double length = std::abs(max - min);
+          size_t nodes = length / h;
+          double scale = 1. / nodes;
+
+          size_t pos = (x.d_y - min) / h;
 
-      // multiply by the slope
-      fmax *= bc.d_timeFnParams[0];
+          if (bc.d_spatialFnParams[0] == -1) pos = (max - x.d_y) / h;
 
-      for (auto d : bc.d_direction) {
-        if (d == 1)
-          (*f)[i].d_x += fmax;
-        else if (d == 2)
-          (*f)[i].d_y += fmax;
-        else if (d == 3)
-          (*f)[i].d_z += fmax;
+          fmax *= pos * scale;
+
+        } break;
+        case 3: {
+          double min = bc.d_z1;
+          double max = bc.d_z2;
+
+          if (bc.d_spatialFnParams[0] == -1) {
+            double max = bc.d_z1;
+            double min = bc.d_z2;
+          }
+
+          double length = std::abs(max - min);
+          size_t nodes = length / h;
+          double scale = 1. / nodes;
+
+          size_t pos = (x.d_z - min) / h;
+
+          if (bc.d_spatialFnParams[0] == -1) pos = (max - x.d_z) / h;
+
+          fmax *= pos * scale;
+
+        } break;
+
+        default:
+          std::cerr << "Invalid dimension" << std::endl;
+          break;
       }
-    }  // loop over nodes
-  }    // loop over bc sets
+    }
+  }
+
+  // apply time function
+  if (bc.d_timeFnType == "linear")
+    fmax *= time;
+  else if (bc.d_timeFnType == "linear_step")
+    fmax *= util::function::linearStepFunc(time, bc.d_timeFnParams[1],
+                                           bc.d_timeFnParams[2]);
+  else if (bc.d_timeFnType == "linear_slow_fast") {
+    if (util::compare::definitelyGreaterThan(time, bc.d_timeFnParams[1]))
+      fmax *= bc.d_timeFnParams[3] * time;
+    else
+      fmax *= bc.d_timeFnParams[2] * time;
+  } else if (bc.d_timeFnType == "sin") {
+    double a = M_PI * bc.d_timeFnParams[1];
+    fmax *= std::sin(a * time);
+  }
+
+  // multiply by the slope
+  fmax *= bc.d_timeFnParams[0];
+
+  for (auto d : bc.d_direction) {
+    if (d == 1)
+      (*f)[i].d_x += fmax;
+    else if (d == 2)
+      (*f)[i].d_y += fmax;
+    else if (d == 3)
+      (*f)[i].d_z += fmax;
+  }
 }
 
 std::string loading::FLoading::printStr(int nt, int lvl) const {
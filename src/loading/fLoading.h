@@ -11,6 +11,7 @@
 
 #include "loading.h"        // base class Loading
 #include "util/point.h"     // definition of Point3
+#include <utility>
 
 // forward declaration
 namespace fe {
@@ -40,6 +41,16 @@ public:
    */
   void apply(const double &time, std::vector<util::Point3> *f, fe::Mesh *mesh);
 
+  /*!
+   * @brief Applies force boundary condition to given nodes
+   * @param time Current time
+   * @param f Vector nodal forces
+   * @param mesh Mesh object
+   * @param nodes List of pairs of bc set and nodal id
+   */
+  void apply(const double &time, std::vector<util::Point3> *f, fe::Mesh *mesh,
+             const std::vector<std::pair<size_t, size_t>> &nodes);
+
   /*!
    * @brief Returns the string containing information about the instance of
    * the object
@@ -59,6 +70,18 @@ public:
    * information)
    * */
   void print(int nt = 0, int lvl = 0) const { std::cout << printStr(nt, lvl); };
+
+private:
+  /*!
+   * @brief Applies force boundary condition of bc set to node
+   * @param time Current time
+   * @param s Id of bc set
+   * @param i Id of node
+   * @param f Vector nodal forces
+   * @param mesh Mesh object
+   */
+  void applyNode(const double &time, const size_t &s, const size_t &i,
+                 std::vector<util::Point3> *f, fe::Mesh *mesh);
 };
 
 } // namespace loading
@@ -11,6 +11,7 @@
 #include "../inp/decks/loadingDeck.h"
 #include "fe/mesh.h"
 #include "util/compare.h"
+#include "util/profiler.h"
 #include "util/utilFunction.h"
 #include "util/utilGeom.h"
 #include "util/utilIO.h"
@@ -165,92 +166,107 @@ loading::ULoading::ULoading(inp::LoadingDeck *deck, fe::Mesh *mesh) {
 
 void loading::ULoading::apply(const double &time, std::vector<util::Point3> *u,
                               std::vector<util::Point3> *v, fe::Mesh *mesh) {
-  for (size_t s = 0; s < d_bcData.size(); s++) {
-    inp::BCData bc = d_bcData[s];
-    for (auto i : d_bcNodes[s]) {
-      util::Point3 x = mesh->getNode(i);
-      double umax = bc.d_timeFnParams[0];
-      double du = 0.;
-      double dv = 0.;
-
-      if (bc.d_regionType == "displacement_from_pum") {
-        if (bc.d_direction.size() != 1) {
-          std::cerr << "The region type: displacement_from_pum support only "
-                       "one direction per set. One set per direction is needed "
-                       "if multiple directions are used for the coupling."
-                    << std::endl;
-          exit(1);
-        }
-        umax = mesh->getPrescribedValues()[i][bc.d_direction[0] - 1];
-      }
+  util::ScopedTimer timer(util::Phase::Loading);
 
-      // apply spatial function
-      if (bc.d_spatialFnType == "sin_x") {
-        double a = M_PI * bc.d_spatialFnParams[0];
-        umax = umax * std::sin(a * x.d_x);
-      } else if (bc.d_spatialFnType == "sin_y") {
-        double a = M_PI * bc.d_spatialFnParams[0];
-        umax = umax * std::sin(a * x.d_y);
-      } else if (bc.d_spatialFnType == "sin_z") {
-        double a = M_PI * bc.d_spatialFnParams[0];
-        umax = umax * std::sin(a * x.d_z);
-      } else if (bc.d_spatialFnType == "linear_x") {
-        double a = bc.d_spatialFnParams[0];
-        umax = umax * a * x.d_x;
-      } else if (bc.d_spatialFnType == "linear_y") {
-        double a = bc.d_spatialFnParams[0];
-        umax = umax * a * x.d_y;
-      } else if (bc.d_spatialFnType == "linear_z") {
-        double a = bc.d_spatialFnParams[0];
-        umax = umax * a * x.d_z;
-      } else if (bc.d_spatialFnType == "constant") {
-        double a = bc.d_spatialFnParams[0];
-        umax = umax * a;
-      }
+  for (size_t s = 0; s < d_bcData.size(); s++)
+    for (auto i : d_bcNodes[s]) applyNode(time, s, i, u, v, mesh);
+}
 
-      // apply time function
-      if (bc.d_timeFnType == "constant")
-        du = umax;
-      else if (bc.d_timeFnType == "linear") {
-        du = umax * time;
-        dv = umax;
-      } else if (bc.d_timeFnType == "quadratic") {
-        du = umax * time + bc.d_timeFnParams[1] * time * time;
-        dv = umax + bc.d_timeFnParams[1] * time;
-      } else if (bc.d_timeFnType == "sin") {
-        double a = M_PI * bc.d_timeFnParams[1];
-        du = umax * std::sin(a * time);
-        dv = umax * a * std::cos(a * time);
-      } else if (bc.d_timeFnType == "linear_step") {
-        du = umax * util::function::linearStepFunc(time, bc.d_timeFnParams[1],
-                                                   bc.d_timeFnParams[2]);
-        dv = umax * util::function::derLinearStepFunc(
-                        time, bc.d_timeFnParams[1], bc.d_timeFnParams[2]);
-      } else if (bc.d_timeFnType == "linear_slow_fast") {
-        if (util::compare::definitelyGreaterThan(time, bc.d_timeFnParams[1])) {
-          du = umax * bc.d_timeFnParams[3] * time;
-          dv = umax * bc.d_timeFnParams[3];
-        } else {
-          du = umax * bc.d_timeFnParams[2] * time;
-          dv = umax * bc.d_timeFnParams[2];
-        }
-      }
+void loading::ULoading::apply(
+    const double &time, std::vector<util::Point3> *u,
+    std::vector<util::Point3> *v, fe::Mesh *mesh,
+    const std::vector<std::pair<size_t, size_t>> &nodes) {
+  util::ScopedTimer timer(util::Phase::Loading);
 
-      for (auto d : bc.d_direction) {
-        if (d == 1) {
-          (*u)[i].d_x = du;
-          (*v)[i].d_x = dv;
-
-        } else if (d == 2) {
-          (*u)[i].d_y = du;
-          (*v)[i].d_y = dv;
-        } else if (d == 3) {
-          (*u)[i].d_z = du;
-          (*v)[i].d_z = dv;
-        }
-      }
-    }  // loop over nodes
-  }    // loop over bc sets
+  for (const auto &n : nodes) applyNode(time, n.first, n.second, u, v, mesh);
+}
+
+void loading::ULoading::applyNode(const double &time, const size_t &s,
+                                  const size_t &i, std::vector<util::Point3> *u,
+                                  std::vector<util::Point3> *v, fe::Mesh *mesh) {
+  const auto &bc = d_bcData[s];
+
+  util::Point3 x = mesh->getNode(i);
+  double umax = bc.d_timeFnParams[0];
+  double du = 0.;
+  double dv = 0.;
+
+  if (bc.d_regionType == "displacement_from_pum") {
+    if (bc.d_direction.size() != 1) {
+      std::cerr << "The region type: displacement_from_pum support only "
+                   "one direction per set. One set per direction is needed "
+                   "if multiple directions are used for the coupling."
+                << std::endl;
+      exit(1);
+    }
+    umax = mesh->getPrescribedValues()[i][bc.d_direction[0] - 1];
+  }
+
+  // apply spatial function
+  if (bc.d_spatialFnType == "sin_x") {
+    double a = M_PI * bc.d_spatialFnParams[0];
+    umax = umax * std::sin(a * x.d_x);
+  } else if (bc.d_spatialFnType == "sin_y") {
+    double a = M_PI * bc.d_spatialFnParams[0];
+    umax = umax * std::sin(a * x.d_y);
+  } else if (bc.d_spatialFnType == "sin_z") {
+    double a = M_PI * bc.d_spatialFnParams[0];
+    umax = umax * std::sin(a * x.d_z);
+  } else if (bc.d_spatialFnType == "linear_x") {
+    double a = bc.d_spatialFnParams[0];
+    umax = umax * a * x.d_x;
+  } else if (bc.d_spatialFnType == "linear_y") {
+    double a = bc.d_spatialFnParams[0];
+    umax = umax * a * x.d_y;
+  } else if (bc.d_spatialFnType == "linear_z") {
+    double a = bc.d_spatialFnParams[0];
+    umax = umax * a * x.d_z;
+  } else if (bc.d_spatialFnType == "constant") {
+    double a = bc.d_spatialFnParams[0];
+    umax = umax * a;
+  }
+
+  // apply time function
+  if (bc.d_timeFnType == "constant")
+    du = umax;
+  else if (bc.d_timeFnType == "linear") {
+    du = umax * time;
+    dv = umax;
+  } else if (bc.d_timeFnType == "quadratic") {
+    du = umax * time + bc.d_timeFnParams[1] * time * time;
+    dv = umax + bc.d_timeFnParams[1] * time;
+  } else if (bc.d_timeFnType == "sin") {
+    double a = M_PI * bc.d_timeFnParams[1];
+    du = umax * std::sin(a * time);
+    dv = umax * a * std::cos(a * time);
+  } else if (bc.d_timeFnType == "linear_step") {
+    du = umax * util::function::linearStepFunc(time, bc.d_timeFnParams[1],
+                                               bc.d_timeFnParams[2]);
+    dv = umax * util::function::derLinearStepFunc(
+                    time, bc.d_timeFnParams[1], bc.d_timeFnParams[2]);
+  } else if (bc.d_timeFnType == "linear_slow_fast") {
+    if (util::compare::definitelyGreaterThan(time, bc.d_timeFnParams[1])) {
+      du = umax * bc.d_timeFnParams[3] * time;
+      dv = umax * bc.d_timeFnParams[3];
+    } else {
+      du = umax * bc.d_timeFnParams[2] * time;
+      dv = umax * bc.d_timeFnParams[2];
+    }
+  }
+
+  for (auto d : bc.d_direction) {
+    if (d == 1) {
+      (*u)[i].d_x = du;
+      (*v)[i].d_x = dv;
+
+    } else if (d == 2) {
+      (*u)[i].d_y = du;
+      (*v)[i].d_y = dv;
+    } else if (d == 3) {
+      (*u)[i].d_z = du;
+      (*v)[i].d_z = dv;
+    }
+  }
 }
 
 std::string loading::ULoading::printStr(int nt, int lvl) const {
@@ -11,6 +11,7 @@
 
 #include "loading.h"        // base class Loading
 #include "util/point.h"     // definition of Point3
+#include <utility>
 
 // forward declaration
 namespace fe {
@@ -42,6 +43,18 @@ public:
   void apply(const double &time, std::vector<util::Point3> *u,
              std::vector<util::Point3> *v, fe::Mesh *mesh);
 
+  /*!
+   * @brief Applies displacement boundary condition to given nodes
+   * @param time Current time
+   * @param u Vector nodal displacements
+   * @param v Vector nodal velocities
+   * @param mesh Mesh object
+   * @param nodes List of pairs of bc set and nodal id
+   */
+  void apply(const double &time, std::vector<util::Point3> *u,
+             std::vector<util::Point3> *v, fe::Mesh *mesh,
+             const std::vector<std::pair<size_t, size_t>> &nodes);
+
   /*!
    * @brief Returns the string containing information about the instance of
    * the object
@@ -61,6 +74,20 @@ public:
    * information)
    * */
   void print(int nt = 0, int lvl = 0) const { std::cout << printStr(nt, lvl); };
+
+private:
+  /*!
+   * @brief Applies displacement boundary condition of bc set to node
+   * @param time Current time
+   * @param s Id of bc set
+   * @param i Id of node
+   * @param u Vector nodal displacements
+   * @param v Vector nodal velocities
+   * @param mesh Mesh object
+   */
+  void applyNode(const double &time, const size_t &s, const size_t &i,
+                 std::vector<util::Point3> *u, std::vector<util::Point3> *v,
+                 fe::Mesh *mesh);
 };
 
 } // namespace loading
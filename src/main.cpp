@@ -9,24 +9,41 @@
 #include <Config.h>
 
 #include <hpx/hpx_main.hpp>  // Need main source file
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
 #include <hpx/modules/program_options.hpp>
 #include <hpx/timing/high_resolution_clock.hpp>
 #include <iostream>
 
 #include "inp/decks/materialDeck.h"
+#include "inp/decks/outputDeck.h"
 #include "inp/input.h"  // Input class
 #include "material/materials.h"
 #include "model/models.h"  // Model class
+#include "util/counters.h"
+#include "util/numa.h"
+#include "util/profiler.h"
 
 namespace inp {
 struct MaterialDeck;
 }  // namespace inp
 
+// performance counters have to be installed before the runtime creates the
+// counters given on command line
+static const bool c_countersRegistered =
+    (hpx::register_startup_function(&util::Counters::registerCounterTypes),
+     true);
+
 int main(int argc, char *argv[]) {
   hpx::program_options::options_description desc("Allowed options");
   desc.add_options()("help", "produce help message")(
       "input-file,i", hpx::program_options::value<std::string>(),
-      "Configuration file");
+      "Configuration file")(
+      "ensemble-file,e", hpx::program_options::value<std::string>(),
+      "Ensemble file")(
+      "dry-run", "Estimate memory and time per step of the input and exit")(
+      "benchmark-forces", hpx::program_options::value<size_t>(),
+      "Time n quasi-static force assemblies of the input and exit");
 
   hpx::program_options::variables_map vm;
   hpx::program_options::store(
@@ -42,7 +59,11 @@ int main(int argc, char *argv[]) {
   std::string filename;
   if (vm.count("input-file")) filename = vm["input-file"].as<std::string>();
 
-  if (filename.empty()) {
+  std::string ensembleFilename;
+  if (vm.count("ensemble-file"))
+    ensembleFilename = vm["ensemble-file"].as<std::string>();
+
+  if (filename.empty() and ensembleFilename.empty()) {
     std::cerr << argv[0] << " (Version " << MAJOR_VERSION << "."
               << MINOR_VERSION << "." << UPDATE_VERSION
               << ") -i input.yaml --hpx:threads=n" << std::endl;
@@ -54,12 +75,72 @@ int main(int argc, char *argv[]) {
   // record current time
   std::uint64_t begin = hpx::chrono::high_resolution_clock::now();
 
+  // run ensemble of models sharing the mesh and neighbor list
+  if (!ensembleFilename.empty()) {
+    model::Ensemble ensemble(ensembleFilename);
+    ensemble.run();
+
+    util::Profiler::getInstance()->finalize();
+    util::Profiler::destroyInstance();
+    util::Numa::destroyInstance();
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+    std::cout << " Time elapsed = " << double(end - begin) / 1.0e9
+              << " sec \n";
+
+    return EXIT_SUCCESS;
+  }
+
   // read input data
   auto *deck = new inp::Input(filename);
 
+  // report the estimates without running the model
+  if (vm.count("dry-run")) {
+    model::dryRun(deck);
+
+    util::Profiler::destroyInstance();
+    util::Numa::destroyInstance();
+
+    return EXIT_SUCCESS;
+  }
+
+  // compare the lock-free and the mutex force assembly without solving
+  if (vm.count("benchmark-forces")) {
+    if (deck->getModelDeck()->d_timeDiscretization != "quasi_static" or
+        deck->getMaterialDeck()->d_materialType != "ElasticState") {
+      std::cerr << "Error: --benchmark-forces requires the quasi_static time "
+                   "discretization and the ElasticState material.\n";
+      exit(1);
+    }
+
+    std::pair<double, double> times;
+    {
+      model::QuasiStaticModel<material::pd::ElasticState> qsModel(deck,
+                                                                  false);
+      times = qsModel.timeForces(vm["benchmark-forces"].as<size_t>());
+    }
+    std::cout << "Benchmark: Threads = " << hpx::get_os_thread_count()
+              << ", lock-free assembly = " << times.first
+              << " sec, mutex assembly = " << times.second
+              << " sec, speedup = " << times.second / times.first << "\n";
+
+    util::Profiler::destroyInstance();
+    util::Numa::destroyInstance();
+
+    return EXIT_SUCCESS;
+  }
+
+  // enable profiling before any phase of the model is timed
+  if (!deck->getOutputDeck()->d_profileFile.empty())
+    util::Profiler::getInstance()->enable(
+        deck->getOutputDeck()->d_profileFile,
+        deck->getOutputDeck()->d_profileFormat);
+
   // check which model to run
   if (deck->getSpatialDiscretization() == "finite_difference") {
-    if (deck->getModelDeck()->d_timeDiscretization == "quasi_static") {
+    if (deck->getModelDeck()->d_timeDiscretization == "quasi_static" or
+        deck->getModelDeck()->d_timeDiscretization == "newmark" or
+        deck->getModelDeck()->d_timeDiscretization == "hht_alpha") {
       if (deck->getMaterialDeck()->d_materialType == "ElasticState") {
         model::QuasiStaticModel<material::pd::ElasticState> QuasiStaticModel(
             deck);
@@ -67,9 +148,22 @@ int main(int argc, char *argv[]) {
     } else if (deck->getModelDeck()->d_timeDiscretization ==
                    "central_difference" or
                deck->getModelDeck()->d_timeDiscretization ==
-                   "velocity_verlet") {
+                   "velocity_verlet" or
+               deck->getModelDeck()->d_timeDiscretization ==
+                   "dynamic_relaxation" or
+               deck->getModelDeck()->d_timeDiscretization ==
+                   "multirate_verlet") {
       if (deck->getMaterialDeck()->d_materialType == "RNPBond") {
-        model::FDModel<material::pd::RNPBond> fdModel(deck);
+        if (hpx::get_num_localities(hpx::launch::sync) > 1) {
+          model::simulateDistributed(deck);
+        } else {
+          model::FDModel<material::pd::RNPBond> fdModel(deck);
+        }
+      } else if (deck->getModelDeck()->d_timeDiscretization ==
+                 "dynamic_relaxation") {
+        std::cerr << "Error: Dynamic relaxation is only supported for the "
+                     "RNPBond material.\n";
+        exit(1);
       }
 
     }
@@ -81,6 +175,10 @@ int main(int argc, char *argv[]) {
     }
   }
 
+  util::Profiler::getInstance()->finalize();
+  util::Profiler::destroyInstance();
+  util::Numa::destroyInstance();
+
   // get time elapsed
   std::uint64_t end = hpx::chrono::high_resolution_clock::now();
   double elapsed_secs = double(end - begin) / 1.0e9;
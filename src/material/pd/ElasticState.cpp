@@ -8,6 +8,7 @@
 #include <iostream>
 
 #include "data/DataManager.h"
+#include "data/fieldRegistry.h"
 #include "inp/decks/materialDeck.h"
 #include "inp/decks/modelDeck.h"
 #include "inp/decks/outputDeck.h"
@@ -42,6 +43,47 @@ material::pd::ElasticState::ElasticState(inp::MaterialDeck *deck,
   d_deck = deck;
   strainEnergy =
       d_dataManager_p->getOutputDeckP()->isTagInOutput("Strain_Energy");
+
+  // The shape tensor only depends on the reference configuration and is
+  // computed once if strain or stress are requested. Materials sharing the
+  // data of a data manager which already holds the shape tensors reuse them.
+  if (d_dataManager_p->getShapeTensorP() == nullptr and
+      (d_dataManager_p->getOutputDeckP()->isTagInOutput("Strain_Tensor") or
+       d_dataManager_p->getOutputDeckP()->isTagInOutput("Stress_Tensor")))
+    computeShapeTensors();
+}
+
+void material::pd::ElasticState::computeShapeTensors() {
+  size_t nnodes = d_dataManager_p->getMeshP()->getNumNodes();
+
+  auto &fields = d_dataManager_p->getFields();
+  auto *shapeTensor =
+      fields.add("Shape_Tensor", nnodes, util::Matrix33(0.));
+  auto *shapeTensorInv =
+      fields.add("Shape_Tensor_Inverse", nnodes, util::Matrix33(0.));
+
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, nnodes, [&](boost::uint64_t i) {
+        (*shapeTensor)[i] = this->K_shape_tensor(i);
+
+        util::Matrixij inv = blaze::inv(
+            blaze::submatrix((*shapeTensor)[i], 0UL, 0UL, dim, dim));
+
+        blaze::submatrix((*shapeTensorInv)[i], 0UL, 0UL, dim, dim) =
+            blaze::trans(inv);
+      });
+
+  d_dataManager_p->setShapeTensorP(shapeTensor);
+  d_dataManager_p->setShapeTensorInvP(shapeTensorInv);
+}
+
+void material::pd::ElasticState::checkShapeTensors() {
+  if (d_dataManager_p->getShapeTensorP() == nullptr) {
+    std::cerr << "Error: Strain and stress require the shape tensors which "
+                 "are only computed if Strain_Tensor or Stress_Tensor is in "
+                 "the output tags.\n";
+    exit(1);
+  }
 }
 
 void material::pd::ElasticState::computeParameters(inp::MaterialDeck *deck,
@@ -297,6 +339,8 @@ util::Matrix33 material::pd::ElasticState::K_shape_tensor(size_t i) {
         X.toMatrix() * w *
         (*d_dataManager_p->getVolumeCorrectionP()->d_volumeCorrection_p)[i][n] *
         (*d_dataManager_p->getMeshP()->getNodalVolumesP())[j];
+
+    n++;
   }
   return K;
 }
@@ -319,21 +363,15 @@ util::Matrix33 material::pd::ElasticState::deformation_gradient(size_t i) {
     n++;
   }
 
-  util::Matrixij inv = util::Matrixij(dim, dim, 0.);
-
-  inv =
-      blaze::inv(blaze::submatrix(this->K_shape_tensor(i), 0UL, 0UL, dim, dim));
-
-  util::Matrix33 shape_tensor_inv;
-
-  blaze::submatrix(shape_tensor_inv, 0UL, 0UL, dim, dim) = blaze::trans(inv);
-
-  util::Matrix33 deformation = tmp * shape_tensor_inv;
+  util::Matrix33 deformation =
+      tmp * (*d_dataManager_p->getShapeTensorInvP())[i];
 
   return deformation;
 }
 
 util::Matrix33 material::pd::ElasticState::getStrain(size_t i) {
+  checkShapeTensors();
+
   util::Matrix33 F = deformation_gradient(i);
 
   util::Matrix33 FTrans = blaze::trans(F);
@@ -430,52 +468,94 @@ util::Matrix33 material::pd::ElasticState::K_modulus_tensor(size_t i, size_t j,
 }
 
 util::Matrix33 material::pd::ElasticState::getStress(size_t i) {
+  return getStress(i, this->getStrain(i));
+}
+
+util::Matrix33 material::pd::ElasticState::getStress(
+    size_t i, const util::Matrix33 &strain) {
+  checkShapeTensors();
+
+  // The modulus tensor K(j,k) = c X_j x X_k + alpha_d M_j x M_j delta(j,k)
+  // is separable, so the double sum over the neighbors j and k reduces to
+  //   c (sum_k a_k X_k . (strain X_k)) (sum_j a_j X_j x X_j)
+  //   + sum_j alpha_d delta_j a_j^2 (M_j . (strain X_j)) M_j x X_j
+  // where a_j is the corrected volume of neighbor j. The second factor of
+  // the first term is the shape tensor.
+  double m_i =
+      (*d_dataManager_p->getVolumeCorrectionP()->d_weightedVolume_p)[i];
+
+  double w = 1;
+  double c = 0.;
+  double alpha = 0.;
+
+  if (dim == 1) {
+    alpha = d_deck->d_matData.d_E / m_i;
+  }
+
+  if (dim == 2) {
+    double Nu = (3. * d_deck->d_matData.d_K - 2. * d_deck->d_matData.d_mu) /
+                (2. * (3. * d_deck->d_matData.d_K + d_deck->d_matData.d_mu));
+
+    double alpha_s = (9. / m_i) * (d_deck->d_matData.d_K +
+                                   std::pow((Nu + 1.) / (2. * Nu - 1.), 2) *
+                                       d_deck->d_matData.d_mu / 9.);
+    double alpha_d = (8. / m_i) * d_deck->d_matData.d_mu;
+    double alpha_sb =
+        (2. * d_factor2D * alpha_s - (3. - 2. * d_factor2D) * alpha_d) / 3.;
+
+    alpha = alpha_d;
+    c = ((alpha_sb - alpha_d) / m_i) * w * w;
+  }
+
+  if (dim == 3) {
+    double alpha_s = (9. / m_i) * d_deck->d_matData.d_K;
+    double alpha_d = (15. / m_i) * d_deck->d_matData.d_mu;
+
+    alpha = alpha_d;
+    c = ((alpha_s - alpha_d) / m_i) * w * w;
+  }
+
   util::Matrix33 stress = util::Matrix33(0.);
+  double sum = 0.;
 
   size_t n = 0;
-
   for (auto j : d_dataManager_p->getNeighborP()->getNeighbors(i)) {
     util::Point3 Xj = this->X_vector_state(i, j);
+    util::Point3 M = Xj / Xj.length();
 
-    size_t m = 0;
+    double volCorr =
+        (*d_dataManager_p->getVolumeCorrectionP()->d_volumeCorrection_p)[i][n];
+    double vol = (*d_dataManager_p->getMeshP()->getNodalVolumesP())[j];
+    double a_j = volCorr * vol;
 
-    for (auto k : d_dataManager_p->getNeighborP()->getNeighbors(i)) {
-      util::Point3 Xk = this->X_vector_state(i, k);
+    util::Vector3 strainX = strain * Xj.toVector();
 
-      double volume = (*d_dataManager_p->getVolumeCorrectionP()
-                            ->d_volumeCorrection_p)[i][m] *
-                      (*d_dataManager_p->getMeshP()->getNodalVolumesP())[k] *
-                      (*d_dataManager_p->getVolumeCorrectionP()
-                            ->d_volumeCorrection_p)[i][n] *
-                      (*d_dataManager_p->getMeshP()->getNodalVolumesP())[j];
+    sum += a_j * blaze::dot(Xj.toVector(), strainX);
 
-      util::Vector3 res = (this->K_modulus_tensor(i, j, k, m) *
-                           (this->getStrain(i) * Xk.toVector()));
+    // contribution of the Dirac delta for k = j
+    double delta = volCorr / vol;
+    double proj = blaze::dot(M.toVector(), strainX);
 
-      util::Matrix33 tmp = util::Matrix33(0.);
-
-      for (size_t o = 0; o < 3; o++) {
-        tmp(o, 0) = res[o] * Xj[0];
-        tmp(o, 1) = res[o] * Xj[1];
-        tmp(o, 2) = res[o] * Xj[2];
-      }
-      stress += tmp * volume;
-
-      m++;
-    }
+    stress += (alpha * w * delta * a_j * a_j * proj) * M.toMatrix(Xj);
 
     n++;
   }
 
+  if (dim > 1) stress += c * sum * (*d_dataManager_p->getShapeTensorP())[i];
+
   return stress;
 }
 
 double material::pd::ElasticState::getFactor2D() { return d_factor2D; }
 
 void material::pd::ElasticState::update() {
-  if (d_dataManager_p->getStateBasedHelperFunctionsP() != nullptr)
-    delete d_dataManager_p->getStateBasedHelperFunctionsP();
+  if (d_dataManager_p->getStateBasedHelperFunctionsP() == nullptr)
+    d_dataManager_p->setStateBasedHelperFunctionsP(
+        new util::StateBasedHelperFunctions(d_dataManager_p, this->d_factor2D));
+  else
+    d_dataManager_p->getStateBasedHelperFunctionsP()->update();
+}
 
-  d_dataManager_p->setStateBasedHelperFunctionsP(
-      new util::StateBasedHelperFunctions(d_dataManager_p, this->d_factor2D));
+void material::pd::ElasticState::updateNode(size_t i) {
+  d_dataManager_p->getStateBasedHelperFunctionsP()->updateNode(i);
 }
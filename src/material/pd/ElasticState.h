@@ -88,6 +88,14 @@ class ElasticState : public BaseMaterial {
    */
   util::Matrix33 getStress(size_t i);
 
+  /*!
+   * @brief Computes the stress tensor for one node from its strain tensor
+   * @param i Id of node i
+   * @param strain The strain tensor for node i
+   * @return The stress tensor for node i
+   */
+  util::Matrix33 getStress(size_t i, const util::Matrix33 &strain);
+
   /*!
    * @brief Computes the strain vector for one node
    * @param i ID of node i
@@ -100,8 +108,24 @@ class ElasticState : public BaseMaterial {
    */
   double getFactor2D();
 
+  /*!
+   * @brief Recomputes the extension and dilatation of all nodes in place
+   */
   void update();
 
+  /*!
+   * @brief The extension and dilatation of node i only depend on the bonds
+   * of node i
+   * @return bool True
+   */
+  bool hasNodeUpdate() const override { return true; }
+
+  /*!
+   * @brief Recomputes the extension and dilatation of node i in place
+   * @param i Id of node
+   */
+  void updateNode(size_t i) override;
+
   /*!
    * @brief Get direction of bond force
    * @return vector Unit vector along the bond force
@@ -137,6 +161,20 @@ class ElasticState : public BaseMaterial {
    */
   /**@{*/
 
+  /*!
+   * @brief Computes the shape tensor and its inverse for all nodes
+   *
+   * The tensors are owned by the field registry of the data manager and
+   * are set in the data manager, so that they are computed once and shared
+   * with the materials of other data managers.
+   */
+  void computeShapeTensors();
+
+  /*!
+   * @brief Exits with an error if the shape tensors are not computed
+   */
+  void checkShapeTensors();
+
   /*!
    * @brief Computes the deformation gradient for node i
    * @param i Id of node
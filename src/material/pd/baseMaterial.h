@@ -60,6 +60,21 @@ public:
 
   };
 
+  /*!
+   * @brief Returns the linearized stiffness of the bond
+   *
+   * This is the derivative of the magnitude of the bond force returned by
+   * getBondEF() with respect to the elongation of the bond. It is used to
+   * estimate the stable (fictitious) mass of explicit schemes. Broken bonds
+   * have zero stiffness. Materials which do not provide the stiffness return
+   * zero.
+   *
+   * @param i Id of node 1
+   * @param j Local id in the neighborlist of node i
+   * @return stiffness Bond stiffness
+   */
+  virtual double getBondStiffness(size_t i, size_t j) { return 0.; };
+
   /*!
    * @brief Returns the bond strain
    * @param dx Reference bond vector
@@ -127,12 +142,41 @@ public:
     return util::Matrix33();
   }
 
+  /*!
+   * @brief Returns stress tensor using the already computed strain tensor
+   *
+   * @param i Id of node
+   * @param strain Strain tensor of node i
+   * @return stress tensor
+   */
+  virtual util::Matrix33 getStress(size_t i, const util::Matrix33 &strain) {
+
+    return getStress(i);
+  }
+
  /*!
    * @brief Let the material class in the quasi-static case know that there is a new 
    * loading step
    */
   virtual void update(){}
 
+  /*!
+   * @brief Returns true if the material state can be updated node by node
+   * using updateNode() instead of update()
+   *
+   * This allows to fuse the update of node i with the computation of the
+   * forces of node i in a single sweep over the nodes.
+   *
+   * @return bool True if updateNode() is implemented
+   */
+  virtual bool hasNodeUpdate() const { return false; }
+
+  /*!
+   * @brief Updates the material state of node i only
+   * @param i Id of node
+   */
+  virtual void updateNode(size_t i) {}
+
   /*!
    * @brief Returns the value of influence function
    *
@@ -227,14 +227,26 @@ void material::pd::RNPBond::computeMaterialProperties(inp::MaterialDeck *deck,
 //    const double &r, const double &s, const double &influence, bool &fs) {
 std::pair<util::Point3, double> material::pd::RNPBond::getBondEF(size_t i,
                                                                  size_t j) {
-  auto force = util::Point3();
-  double energy = 0.;
-
   // get global id of j
   auto j_id = d_dataManager_p->getNeighborP()->getNeighbor(i, j);
 
   // get fracture state
   auto fs = d_dataManager_p->getFractureP()->getBondState(i, j);
+  const bool fs_old = fs;
+
+  auto ef = getBondEF(i, j_id, fs);
+
+  // update bond-state
+  if (fs != fs_old) d_dataManager_p->getFractureP()->setBondState(i, j, fs);
+
+  return ef;
+}
+
+std::pair<util::Point3, double> material::pd::RNPBond::getBondEF(size_t i,
+                                                                 size_t j_id,
+                                                                 bool &fs) {
+  auto force = util::Point3();
+  double energy = 0.;
 
   // get location of nodes
   auto xi = d_dataManager_p->getMeshP()->getNode(i);
@@ -277,9 +289,6 @@ std::pair<util::Point3, double> material::pd::RNPBond::getBondEF(size_t i,
                                              d_factorSc * getSc(rji)))
       fs = true;
 
-    // update bond-state
-    d_dataManager_p->getFractureP()->setBondState(i, j, fs);
-
     // if bond is not fractured, return energy and force from nonlinear
     // potential otherwise return energy of fractured bond, and zero force
     if (!fs) {
@@ -312,6 +321,29 @@ std::pair<util::Point3, double> material::pd::RNPBond::getBondEF(size_t i,
   }
 }
 
+double material::pd::RNPBond::getBondStiffness(size_t i, size_t j) {
+  return getBondStiffness(i, d_dataManager_p->getNeighborP()->getNeighbor(i, j),
+                          d_dataManager_p->getFractureP()->getBondState(i, j));
+}
+
+double material::pd::RNPBond::getBondStiffness(size_t i, size_t j_id,
+                                               bool fs) {
+  // broken bonds only carry the contact force
+  if (fs) return 0.;
+
+  auto rji = d_dataManager_p->getMeshP()->getNode(j_id).dist(
+      d_dataManager_p->getMeshP()->getNode(i));
+
+  // get corrected volume of node j
+  auto h = d_dataManager_p->getMeshP()->getMeshSize();
+  auto volj = d_dataManager_p->getMeshP()->getNodalVolume(j_id);
+  if (util::compare::definitelyGreaterThan(rji, d_horizon - 0.5 * h))
+    volj *= (d_horizon + 0.5 * h - rji) / h;
+
+  return d_baseInfluenceFn_p->getInfFn(rji / d_horizon) * 4. * d_C * d_beta /
+         (d_invFactor * rji) * volj;
+}
+
 double material::pd::RNPBond::getS(const util::Point3 &dx,
                                    const util::Point3 &du) {
   return dx.dot(du) / dx.dot(dx);
@@ -100,6 +100,48 @@ public:
 	 */
   std::pair<util::Point3, double> getBondEF(size_t i, size_t j);
 
+  /*!
+   * @brief Returns energy and force state between node i and node j given
+   * by its global id
+   *
+   * Used when bonds are enumerated without neighbor list. The fracture state
+   * of bond is passed in and updated instead of read from and written to
+   * geometry::Fracture.
+   *
+   * @param i Id of node i
+   * @param j_id Global id of node j
+   * @param fs Fracture state of bond (true if broken)
+   * @return Value Pair of energy and force
+   */
+  std::pair<util::Point3, double> getBondEF(size_t i, size_t j_id, bool &fs);
+
+  /*!
+   * @brief Returns the stiffness of the bond linearized at zero strain
+   *
+   * \f[ k_{ij} = \frac{4 J(r_{ij}/\epsilon) C \beta}{\bar{\omega} r_{ij}}
+   * V_j, \f]
+   * where \f$ \bar{\omega} \f$ is the inverse factor and \f$ V_j \f$ the
+   * corrected volume of node j.
+   *
+   * @param i Id of node i
+   * @param j Local id in the neighbor list of node i
+   * @return stiffness Bond stiffness
+   */
+  double getBondStiffness(size_t i, size_t j);
+
+  /*!
+   * @brief Returns the stiffness of the bond between node i and node j given
+   * by its global id
+   *
+   * Used when bonds are enumerated without neighbor list.
+   *
+   * @param i Id of node i
+   * @param j_id Global id of node j
+   * @param fs Fracture state of bond (true if broken)
+   * @return stiffness Bond stiffness
+   */
+  double getBondStiffness(size_t i, size_t j_id, bool fs);
+
   /*!
    * @brief Returns the bond strain
    * @param dx Reference bond vector
@@ -158,6 +200,54 @@ public:
 */
   util::Point3 getDissipation(size_t i, size_t j) const;
 
+  /*!
+   * @brief Returns the factor of the bond force
+   *
+   * The force of an unbroken bond with strain S is this factor times
+   * \f$ J(r/\epsilon) S \exp(-\beta r S^2) V_j \f$.
+   *
+   * @return factor Factor \f$ 4 C \beta / (\omega_d \epsilon^{d+1}) \f$
+   */
+  double getForceFactor() const { return 4. * d_C * d_beta / d_invFactor; }
+
+  /*!
+   * @brief Returns the parameter beta of the bond potential
+   * @return beta Parameter beta
+   */
+  double getBeta() const { return d_beta; }
+
+  /*!
+   * @brief Returns the critical strain times square root of bond length
+   * including the factor used to check bond failure
+   * @return value Factor times \f$ \bar{r} \f$
+   */
+  double getScFactor() const { return d_factorSc * d_rbar; }
+
+  /*!
+   * @brief Returns the critical strain times square root of bond length
+   * @return rbar Value \f$ \bar{r} \f$
+   */
+  double getRbar() const { return d_rbar; }
+
+  /*!
+   * @brief Returns true if bonds break irreversibly
+   * @return flag True if bond break is irreversible
+   */
+  bool isIrreversible() const { return d_irrevBondBreak; }
+
+  /*!
+   * @brief Returns the contact force coefficient between nodes of broken
+   * bonds
+   * @return Kn Contact force coefficient
+   */
+  double getContactKn() const { return d_contact_Kn; }
+
+  /*!
+   * @brief Returns the contact radius
+   * @return Rc Contact radius
+   */
+  double getContactRc() const { return d_contact_Rc; }
+
 private:
   /*!
    * @brief Computes rnp material parameters from elastic constants
@@ -0,0 +1,257 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include "dryRun.h"
+
+#include <hpx/include/runtime.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "fd/fDModel.h"
+#include "fe/mesh.h"
+#include "geometry/neighbor.h"
+#include "inp/decks/materialDeck.h"
+#include "inp/decks/modelDeck.h"
+#include "inp/decks/outputDeck.h"
+#include "inp/input.h"
+#include "inp/policy.h"
+#include "material/pd/rnpBond.h"
+#include "util/point.h"
+
+namespace {
+
+/*! @brief Maximum number of nodes for which the neighbor list is built */
+const size_t c_sampleNodes = 20000;
+
+/*! @brief Output field allocated per node in addition to the state */
+struct OutputField {
+  /*! @brief Output tag */
+  std::string d_tag;
+  /*! @brief Tag of policy which controls the population of data */
+  std::string d_policyTag;
+  /*! @brief Bytes per node */
+  size_t d_bytes;
+};
+
+/*! @brief Output fields of FDModel */
+const std::vector<OutputField> c_outputFields = {
+    {"Strain_Energy", "Model_d_e", sizeof(float)},
+    {"Work_Done", "Model_d_w", sizeof(float)},
+    {"Damage_Phi", "Model_d_phi", sizeof(float)},
+    {"Damage_Z", "Model_d_Z", sizeof(float)},
+    {"Fracture_Perienergy_Total", "Model_d_eF", sizeof(float)},
+    {"Fracture_Perienergy_Bond", "Model_d_eFB", sizeof(float)}};
+
+/*! @brief Output tags with a vector per node */
+const std::vector<std::string> c_vectorTags = {
+    "Displacement", "Velocity", "Force", "Force_Density", "Reaction_Force"};
+
+/*! @brief Returns time since begin in seconds */
+double getSeconds(std::uint64_t begin) {
+  return double(hpx::chrono::high_resolution_clock::now() - begin) / 1.0e9;
+}
+
+} // namespace
+
+void model::dryRun(inp::Input *deck) {
+  auto *modelDeck = deck->getModelDeck();
+  auto *outputDeck = deck->getOutputDeck();
+  auto *policy = inp::Policy::getInstance(deck->getPolicyDeck());
+
+  const std::string scheme = modelDeck->d_timeDiscretization;
+  const size_t nsteps = modelDeck->d_Nt;
+  const double horizon = modelDeck->d_horizon;
+  const bool implicit = scheme == "quasi_static" or scheme == "newmark" or
+                        scheme == "hht_alpha";
+  const std::string materialType = deck->getMaterialDeck()->d_materialType;
+  const bool onTheFly =
+      !policy->populateData(inp::PolicyTag::Neighbor_d_list);
+
+  std::cout << "DryRun: Reading mesh.\n";
+  std::uint64_t begin = hpx::chrono::high_resolution_clock::now();
+  auto *mesh = new fe::Mesh(deck->getMeshDeck());
+  const double meshTime = getSeconds(begin);
+
+  const size_t nnodes = mesh->getNumNodes();
+  const size_t dim = mesh->getDimension();
+
+  // compact sample of nodes closest to the center of the mesh
+  const auto &box = mesh->getBoundingBox();
+  util::Point3 center;
+  for (size_t d = 0; d < 3; d++)
+    center[d] = 0.5 * (box.first[d] + box.second[d]);
+
+  std::vector<double> dist(nnodes);
+  for (size_t i = 0; i < nnodes; i++)
+    dist[i] = (mesh->getNode(i) - center).length();
+
+  const size_t nsample = std::min(nnodes, c_sampleNodes);
+  std::vector<size_t> ids(nnodes);
+  std::iota(ids.begin(), ids.end(), 0);
+  if (nsample < nnodes) {
+    std::nth_element(
+        ids.begin(), ids.begin() + nsample, ids.end(),
+        [&dist](size_t a, size_t b) { return dist[a] < dist[b]; });
+    ids.resize(nsample);
+    std::sort(ids.begin(), ids.end());
+  }
+
+  double radius = 0.;
+  for (auto i : ids) radius = std::max(radius, dist[i]);
+
+  std::cout << "DryRun: Creating neighbor list of " << nsample
+            << " sample nodes.\n";
+  auto *sample = new fe::Mesh(*mesh, ids);
+  begin = hpx::chrono::high_resolution_clock::now();
+  auto *neighbor = new geometry::Neighbor(horizon, deck->getNeighborDeck(),
+                                          sample->getNodesP());
+  const double neighborTime = getSeconds(begin);
+
+  // bonds of nodes whose neighborhood lies inside the sample are
+  // representative for the full mesh
+  size_t sampleBonds = 0;
+  size_t interiorBonds = 0;
+  size_t ninterior = 0;
+  for (size_t k = 0; k < nsample; k++) {
+    const size_t n = neighbor->getNeighbors(k).size();
+    sampleBonds += n;
+    if (nsample == nnodes or dist[ids[k]] + horizon <= radius) {
+      interiorBonds += n;
+      ninterior++;
+    }
+  }
+  if (ninterior == 0) {
+    interiorBonds = sampleBonds;
+    ninterior = nsample;
+  }
+
+  const double bonds = nsample == nnodes
+                           ? double(sampleBonds)
+                           : double(nnodes) * double(interiorBonds) /
+                                 double(ninterior);
+
+  // memory of data structures in bytes
+  std::vector<std::pair<std::string, double>> memory;
+  memory.emplace_back("Nodes", double(nnodes) * (sizeof(util::Point3) +
+                                                 sizeof(double) +
+                                                 sizeof(uint8_t)));
+  memory.emplace_back(
+      "Elements",
+      double(mesh->getElementConnectivities().size() * sizeof(size_t)));
+  if (onTheFly) {
+    // one id per node and one offset per cell, and the broken bonds which
+    // are empty at start
+    double ncells = 1.;
+    for (size_t d = 0; d < 3; d++)
+      ncells *= std::floor((box.second[d] - box.first[d]) / horizon) + 1.;
+    memory.emplace_back("Cell list",
+                        (double(nnodes) + ncells + 1.) * sizeof(size_t));
+    memory.emplace_back("Fracture state",
+                        double(nnodes) * sizeof(std::vector<size_t>));
+  } else {
+    memory.emplace_back("Neighbor list",
+                        bonds * sizeof(size_t) +
+                            double(nnodes) * sizeof(std::vector<size_t>));
+    memory.emplace_back("Fracture state",
+                        bonds / 8. + double(nnodes) *
+                                         (sizeof(std::vector<uint8_t>) + 1.));
+  }
+  if (materialType == "ElasticState")
+    memory.emplace_back("Volume correction",
+                        bonds * sizeof(double) +
+                            double(nnodes) * (sizeof(std::vector<double>) +
+                                              sizeof(double)));
+
+  // displacement, velocity, force (and body force for implicit schemes)
+  memory.emplace_back("State fields", double(nnodes) * (implicit ? 4 : 3) *
+                                          sizeof(util::Point3));
+
+  size_t fieldBytes = 0;
+  if (outputDeck->isTagInOutput("Reaction_Force") or
+      outputDeck->isTagInOutput("Total_Reaction_Force"))
+    fieldBytes += sizeof(util::Point3) + sizeof(double);
+  if (policy->populateData("Model_d_e")) fieldBytes += sizeof(float);
+  if (policy->enablePostProcessing())
+    for (const auto &f : c_outputFields)
+      if (outputDeck->isTagInOutput(f.d_tag) and
+          policy->populateData(f.d_policyTag))
+        fieldBytes += f.d_bytes;
+  memory.emplace_back("Output fields", double(nnodes) * fieldBytes);
+
+  // the writer holds the nodes and one array per tag
+  size_t bufferBytes = sizeof(util::Point3);
+  for (const auto &tag : outputDeck->d_outTags)
+    bufferBytes += std::find(c_vectorTags.begin(), c_vectorTags.end(),
+                             tag) != c_vectorTags.end()
+                       ? sizeof(util::Point3)
+                       : sizeof(double);
+  memory.emplace_back("Output buffer", double(nnodes) * bufferBytes);
+
+  if (implicit) {
+    const double ndofs = double(dim * nnodes);
+    memory.emplace_back("Jacobian", ndofs * ndofs * sizeof(double));
+    memory.emplace_back("Thread local fields",
+                        double(hpx::get_os_thread_count()) * 4. *
+                            double(nnodes) * sizeof(util::Point3));
+  }
+
+  delete mesh;
+
+  double total = 0.;
+  std::cout << "DryRun: Number of nodes = " << nnodes
+            << ", estimated number of bonds = " << size_t(bonds)
+            << ", bonds per node = " << bonds / double(nnodes) << "\n";
+  std::cout << "DryRun: Memory policy level = "
+            << policy->getMemoryControlFlag() << "\n";
+  std::cout << "DryRun: Estimated memory:\n";
+  for (const auto &m : memory) {
+    std::cout << "  " << m.first << " = " << m.second / (1024. * 1024.)
+              << " MB\n";
+    total += m.second;
+  }
+  std::cout << "  Total = " << total / (1024. * 1024.) << " MB\n";
+
+  std::cout << "DryRun: Mesh read time = " << meshTime
+            << " sec, estimated neighbor list time = "
+            << neighborTime * double(nnodes) / double(nsample) << " sec\n";
+
+  // time the force computation of the sample nodes
+  if (!implicit and materialType == "RNPBond" and sampleBonds > 0) {
+    std::cout << "DryRun: Calibrating force computation on sample nodes.\n";
+    double forceTime = 0.;
+    {
+      model::FDModel<material::pd::RNPBond> fdModel(deck, sample, neighbor,
+                                                    nullptr);
+      forceTime = fdModel.timeForces();
+    }
+
+    const double stepTime = forceTime * bonds / double(sampleBonds);
+    std::cout << "DryRun: Estimated force computation time per step = "
+              << stepTime << " sec, for " << nsteps
+              << " steps = " << stepTime * double(nsteps) << " sec\n";
+    if (onTheFly)
+      std::cout << "DryRun: Bonds are enumerated on the fly at memory control "
+                   "level 4, which is slower than the estimate.\n";
+    if (scheme == "multirate_verlet" or scheme == "dynamic_relaxation")
+      std::cout << "DryRun: Time discretization " << scheme
+                << " computes the force of nodes more than once per step.\n";
+  } else
+    std::cout << "DryRun: Time per step is only estimated for explicit "
+                 "schemes with RNPBond material.\n";
+
+  delete neighbor;
+  delete sample;
+}
@@ -0,0 +1,45 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MODEL_DRYRUN_H
+#define MODEL_DRYRUN_H
+
+// forward declaration of class
+namespace inp {
+class Input;
+} // namespace inp
+
+namespace model {
+
+/*!
+ * @brief Estimates memory and run time of a simulation without running it
+ *
+ * The mesh is read, and the neighbor list is built only for a compact
+ * sample of nodes around the center of the mesh. The number of bonds of
+ * the full mesh is extrapolated from the sample nodes whose neighborhood
+ * lies inside the sample, which over-estimates the bonds of nodes near the
+ * boundary of the body. From this, the memory of nodes, neighbor lists,
+ * fracture state, volume correction, nodal fields, output buffers, and the
+ * Jacobian of implicit schemes is reported, taking into account the fields
+ * disabled by the memory control level of inp::Policy. At level 4, the cell
+ * list replaces the neighbor list and only broken bonds are stored.
+ *
+ * For the explicit schemes with the RNPBond material, a model of the
+ * sample nodes is created and its force computation is timed. The time per
+ * step is the time of the sample scaled by the ratio of bonds.
+ *
+ * @note The model and output decks of the input are freed by the sample
+ * model, so the input can not be used to run a model afterwards.
+ *
+ * @param deck The input deck
+ */
+void dryRun(inp::Input *deck);
+
+} // namespace model
+
+#endif // MODEL_DRYRUN_H
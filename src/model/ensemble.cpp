@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ensemble.h"
+
+#include <yaml-cpp/yaml.h>
+
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+
+#include <filesystem>
+#include <iostream>
+
+#include "fd/batchFDModel.h"
+#include "fd/fDModel.h"
+#include "fe/mesh.h"
+#include "geometry/fracture.h"
+#include "geometry/neighbor.h"
+#include "inp/decks/materialDeck.h"
+#include "inp/decks/modelDeck.h"
+#include "inp/decks/outputDeck.h"
+#include "inp/input.h"
+#include "material/materials.h"
+#include "util/profiler.h"
+
+namespace {
+
+/*!
+ * @brief Merges the nodes of a member into the base node
+ * @param base Node of the base input
+ * @param member Node of the member
+ */
+void mergeNode(YAML::Node base, const YAML::Node &member) {
+  for (auto it : member) {
+    auto key = it.first.as<std::string>();
+    if (it.second.IsMap() and base[key] and base[key].IsMap())
+      mergeNode(base[key], it.second);
+    else
+      base[key] = YAML::Clone(it.second);
+  }
+}
+
+} // namespace
+
+model::Ensemble::Ensemble(const std::string &filename)
+    : d_mesh_p(nullptr), d_neighbor_p(nullptr), d_fracture_p(nullptr) {
+  YAML::Node config = YAML::LoadFile(filename);
+
+  if (!config["Ensemble"]["Input"] or !config["Ensemble"]["Members"]) {
+    std::cerr << "Error: Ensemble requires the tags Input and Members.\n";
+    exit(1);
+  }
+
+  auto inputFilename = config["Ensemble"]["Input"].as<std::string>();
+  YAML::Node base = YAML::LoadFile(inputFilename);
+
+  // read the base input and create the shared data
+  auto *deck = new inp::Input(inputFilename);
+  d_inputs.push_back(deck);
+
+  if (deck->getModelDeck()->d_simType != "explicit" or
+      deck->getMaterialDeck()->d_materialType != "RNPBond") {
+    std::cerr << "Error: Ensemble only supports explicit schemes with "
+                 "RNPBond material.\n";
+    exit(1);
+  }
+
+  if (deck->getModelDeck()->d_isRestartActive) {
+    std::cerr << "Error: Ensemble does not support restart.\n";
+    exit(1);
+  }
+
+  // profiling of the ensemble is controlled by the base input
+  if (!deck->getOutputDeck()->d_profileFile.empty())
+    util::Profiler::getInstance()->enable(
+        deck->getOutputDeck()->d_profileFile,
+        deck->getOutputDeck()->d_profileFormat);
+
+  std::cout << "Ensemble: Creating shared mesh.\n";
+  {
+    util::ScopedTimer timer(util::Phase::MeshRead);
+    d_mesh_p = new fe::Mesh(deck->getMeshDeck());
+    d_mesh_p->clearElementData();
+  }
+
+  std::cout << "Ensemble: Creating shared neighbor list.\n";
+  {
+    util::ScopedTimer timer(util::Phase::NeighborBuild);
+    d_neighbor_p =
+        new geometry::Neighbor(deck->getModelDeck()->d_horizon,
+                               deck->getNeighborDeck(), d_mesh_p->getNodesP());
+  }
+
+  std::cout << "Ensemble: Creating reference fracture state of bonds.\n";
+  {
+    util::ScopedTimer timer(util::Phase::FractureInit);
+    d_fracture_p =
+        new geometry::Fracture(deck->getFractureDeck(), d_mesh_p->getNodesP(),
+                               d_neighbor_p->getNeighborsListP());
+  }
+
+  size_t batchSize = 1;
+  if (config["Ensemble"]["Batch_Size"])
+    batchSize = config["Ensemble"]["Batch_Size"].as<size_t>();
+
+  std::vector<std::string> sharedTags = {
+      "Model", "Mesh", "Neighbor", "Displacement_BC", "Restart", "Policy"};
+
+  if (batchSize > 1) {
+    if (deck->getModelDeck()->d_timeDiscretization != "velocity_verlet") {
+      std::cerr << "Error: Batched ensemble requires time discretization "
+                   "velocity_verlet.\n";
+      exit(1);
+    }
+
+    if (base["Absorbing_Condition"]) {
+      std::cerr << "Error: Batched ensemble does not support absorbing "
+                   "condition.\n";
+      exit(1);
+    }
+
+    sharedTags.emplace_back("No_Fail_Region");
+    sharedTags.emplace_back("Absorbing_Condition");
+  }
+
+  // decks of members of current batch
+  std::vector<inp::Input *> batchDecks;
+  std::vector<bool> batchCopyFracture;
+
+  // create members one after another since they modify the fixity of the
+  // shared mesh and the policy object
+  size_t k = 0;
+  for (auto member : config["Ensemble"]["Members"]) {
+    for (const auto &tag : sharedTags)
+      if (member[tag]) {
+        std::cerr << "Error: Member " << k << " of ensemble modifies tag "
+                  << tag << " which is shared by all members.\n";
+        exit(1);
+      }
+
+    // models disable the data of tags not in the output in the policy object,
+    // which is shared by all members
+    if (member["Output"]["Tags"]) {
+      std::cerr << "Error: Member " << k << " of ensemble modifies tag "
+                << "Output: Tags which is shared by all members.\n";
+      exit(1);
+    }
+
+    YAML::Node memberConfig = YAML::Clone(base);
+    mergeNode(memberConfig, member);
+
+    // default output path of member is a subdirectory of the base path
+    if (!member["Output"]["Path"]) {
+      std::string path = deck->getOutputDeck()->d_path + "member_" +
+                         std::to_string(k) + "/";
+      memberConfig["Output"]["Path"] = path;
+      std::filesystem::create_directories(path);
+    }
+
+    YAML::Emitter out;
+    out << memberConfig;
+
+    auto *memberDeck = new inp::Input(inputFilename, out.c_str());
+    d_inputs.push_back(memberDeck);
+
+    if (memberDeck->getMaterialDeck()->d_materialType != "RNPBond") {
+      std::cerr << "Error: Member " << k
+                << " of ensemble does not use RNPBond material.\n";
+      exit(1);
+    }
+
+    if (batchSize > 1) {
+      batchDecks.push_back(memberDeck);
+      batchCopyFracture.push_back(!member["Fracture"]);
+    } else {
+      std::cout << "Ensemble: Creating member " << k << ".\n";
+      d_members.push_back(new model::FDModel<material::pd::RNPBond>(
+          memberDeck, d_mesh_p, d_neighbor_p,
+          member["Fracture"] ? nullptr : d_fracture_p));
+    }
+
+    k++;
+
+    // create batch once it is full or after the last member
+    if (!batchDecks.empty() and
+        (batchDecks.size() == batchSize or
+         k == config["Ensemble"]["Members"].size())) {
+      std::cout << "Ensemble: Creating batch " << d_batches.size() << ".\n";
+      d_batches.push_back(new model::BatchFDModel(
+          batchDecks, d_mesh_p, d_neighbor_p, d_fracture_p, batchCopyFracture));
+      batchDecks.clear();
+      batchCopyFracture.clear();
+    }
+  }
+}
+
+model::Ensemble::~Ensemble() {
+  for (auto *member : d_members) delete member;
+  for (auto *batch : d_batches) delete batch;
+  for (auto *deck : d_inputs) delete deck;
+
+  delete d_fracture_p;
+  delete d_neighbor_p;
+  delete d_mesh_p;
+}
+
+void model::Ensemble::run() {
+  std::vector<hpx::future<void>> fs;
+  fs.reserve(d_members.size() + d_batches.size());
+
+  for (auto *member : d_members)
+    fs.push_back(hpx::async([member]() { member->simulate(); }));
+
+  for (auto *batch : d_batches)
+    fs.push_back(hpx::async([batch]() { batch->simulate(); }));
+
+  hpx::wait_all(fs);
+}
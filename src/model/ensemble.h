@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MODEL_ENSEMBLE_H
+#define MODEL_ENSEMBLE_H
+
+#include <string>
+#include <vector>
+
+// forward declaration of class
+namespace fe {
+class Mesh;
+} // namespace fe
+
+namespace geometry {
+class Fracture;
+class Neighbor;
+} // namespace geometry
+
+namespace inp {
+class Input;
+} // namespace inp
+
+namespace material {
+namespace pd {
+class RNPBond;
+}
+} // namespace material
+
+namespace model {
+
+template <class T> class FDModel;
+class BatchFDModel;
+
+/*! @brief A class to run an ensemble of finite difference models in one
+ * process
+ *
+ * The ensemble file lists a base input file and the modifications of each
+ * member:
+ *
+ * ```yaml
+ * Ensemble:
+ *   Input: input.yaml
+ *   Members:
+ *     - Material:
+ *         E: 72.0e+9
+ *     - Material:
+ *         E: 80.0e+9
+ *       Fracture:
+ *         Cracks:
+ *           Sets: 0
+ * ```
+ *
+ * The modifications of a member are merged into the base input. Mesh and
+ * neighbor list are created once and shared read-only by all members.
+ * Members which do not modify the `Fracture` tag copy the initial state of
+ * bonds from a reference fracture object. Members are created one after
+ * another and integrated in time as concurrent tasks.
+ *
+ * If `Batch_Size` is larger than one, groups of that many members are
+ * integrated in lockstep by BatchFDModel, and the batches are run as
+ * concurrent tasks. Batched members use the velocity verlet scheme and can
+ * not modify the tags `No_Fail_Region` and `Absorbing_Condition` in
+ * addition.
+ *
+ * @note Only the explicit schemes with the RNPBond material are supported.
+ * Tags which define the shared data, i.e. `Model`, `Mesh`, `Neighbor`,
+ * `Displacement_BC`, `Restart`, and `Policy`, can not be modified.
+ */
+class Ensemble {
+
+public:
+  /*!
+   * @brief Constructor
+   *
+   * Reads the ensemble file and creates all members.
+   *
+   * @param filename Filename of ensemble file
+   */
+  explicit Ensemble(const std::string &filename);
+
+  ~Ensemble();
+
+  /*!
+   * @brief Integrates all members in time
+   */
+  void run();
+
+private:
+  /*! @brief Input decks of members */
+  std::vector<inp::Input *> d_inputs;
+
+  /*! @brief Members */
+  std::vector<model::FDModel<material::pd::RNPBond> *> d_members;
+
+  /*! @brief Batches of members integrated in lockstep */
+  std::vector<model::BatchFDModel *> d_batches;
+
+  /*! @brief Shared mesh */
+  fe::Mesh *d_mesh_p;
+
+  /*! @brief Shared neighbor list */
+  geometry::Neighbor *d_neighbor_p;
+
+  /*! @brief Reference fracture object */
+  geometry::Fracture *d_fracture_p;
+};
+
+} // namespace model
+
+#endif // MODEL_ENSEMBLE_H
@@ -0,0 +1,469 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include "batchFDModel.h"
+
+#include <hpx/include/parallel_algorithm.hpp>
+
+#include <cmath>
+#include <iostream>
+
+#include "data/DataManager.h"
+#include "fe/mesh.h"
+#include "geometry/fracture.h"
+#include "geometry/interiorFlags.h"
+#include "geometry/neighbor.h"
+#include "inp/decks/materialDeck.h"
+#include "inp/decks/modelDeck.h"
+#include "inp/decks/outputDeck.h"
+#include "inp/input.h"
+#include "loading/fLoading.h"
+#include "loading/initialCondition.h"
+#include "loading/uLoading.h"
+#include "material/materials.h"
+#include "rw/writer.h"
+#include "util/compare.h"
+#include "util/counters.h"
+#include "util/profiler.h"
+
+model::BatchFDModel::BatchFDModel(const std::vector<inp::Input *> &decks,
+                                  fe::Mesh *mesh, geometry::Neighbor *neighbor,
+                                  const geometry::Fracture *fracture,
+                                  const std::vector<bool> &copyFracture)
+    : d_decks(decks),
+      d_mesh_p(mesh),
+      d_neighbor_p(neighbor),
+      d_W(decks.size()),
+      d_dim(decks[0]->getModelDeck()->d_dim),
+      d_n(0),
+      d_time(0.),
+      d_contactRc(0.),
+      d_contact(false),
+      d_uLoading_p(nullptr) {
+  if (d_W == 0 or d_W > c_maxBatchSize) {
+    std::cerr << "Error: Batch size should be between 1 and "
+              << c_maxBatchSize << ".\n";
+    exit(1);
+  }
+
+  const size_t nnodes = d_mesh_p->getNumNodes();
+  const auto *matDeck0 = d_decks[0]->getMaterialDeck();
+
+  d_forceFactor.fill(0.);
+  d_beta.fill(0.);
+  d_scFactor.fill(0.);
+  d_rbar.fill(1.);
+  d_irrev.fill(0);
+  d_contactKn.fill(0.);
+  d_invDensity.fill(0.);
+
+  // the material objects are only needed to compute the parameters of the
+  // members
+  data::DataManager dataManager;
+  dataManager.setMeshP(d_mesh_p);
+  dataManager.setNeighborP(d_neighbor_p);
+
+  for (size_t m = 0; m < d_W; m++) {
+    auto *deck = d_decks[m];
+    auto *matDeck = deck->getMaterialDeck();
+
+    if (matDeck->d_materialType != "RNPBond" or matDeck->d_has_disserpation) {
+      std::cerr << "Error: Batched ensemble supports only RNPBond material "
+                   "without dissipation.\n";
+      exit(1);
+    }
+
+    if (matDeck->d_influenceFnType != matDeck0->d_influenceFnType or
+        matDeck->d_influenceFnParams != matDeck0->d_influenceFnParams) {
+      std::cerr << "Error: Members of a batched ensemble require the same "
+                   "influence function.\n";
+      exit(1);
+    }
+
+    dataManager.setModelDeckP(deck->getModelDeck());
+    material::pd::RNPBond material(matDeck, &dataManager);
+
+    d_forceFactor[m] = material.getForceFactor();
+    d_beta[m] = material.getBeta();
+    d_scFactor[m] = material.getScFactor();
+    d_rbar[m] = material.getRbar();
+    d_irrev[m] = material.isIrreversible();
+    d_contactKn[m] = material.getContactKn();
+    d_invDensity[m] = 1. / material.getDensity();
+    if (matDeck->d_applyContact) {
+      d_contact = true;
+      d_contactRc = material.getContactRc();
+    }
+
+    // bond data is computed with the influence function of first member
+    if (m == 0) initBonds(material);
+
+    // fracture state of bonds
+    if (copyFracture[m])
+      d_fracture.push_back(
+          new geometry::Fracture(deck->getFractureDeck(), *fracture));
+    else
+      d_fracture.push_back(new geometry::Fracture(
+          deck->getFractureDeck(), d_mesh_p->getNodesP(),
+          d_neighbor_p->getNeighborsListP()));
+
+    // force loading
+    d_fLoading.push_back(
+        new loading::FLoading(deck->getLoadingDeck(), d_mesh_p));
+  }
+
+  // displacement loading is the same for all members
+  d_uLoading_p = new loading::ULoading(d_decks[0]->getLoadingDeck(), d_mesh_p);
+
+  // interior flags are the same for all members
+  {
+    geometry::InteriorFlags flags(d_decks[0]->getInteriorFlagsDeck(),
+                                  d_mesh_p->getNodesP(),
+                                  d_mesh_p->getBoundingBox());
+    d_canBreak.resize(nnodes);
+    for (size_t i = 0; i < nnodes; i++)
+      d_canBreak[i] = flags.getInteriorFlag(i, d_mesh_p->getNode(i));
+  }
+
+  // initialize nodal data
+  d_u = std::vector<double>(3 * nnodes * d_W, 0.);
+  d_v = std::vector<double>(3 * nnodes * d_W, 0.);
+  d_f = std::vector<double>(3 * nnodes * d_W, 0.);
+  d_fExt = std::vector<double>(3 * nnodes * d_W, 0.);
+  d_Z = std::vector<float>(nnodes * d_W, 0.);
+
+  d_bondState.resize(nnodes);
+  for (size_t i = 0; i < nnodes; i++) {
+    const auto &i_neighs = d_neighbor_p->getNeighbors(i);
+    d_bondState[i] = std::vector<uint8_t>(i_neighs.size() * d_W, 0);
+    for (size_t j = 0; j < i_neighs.size(); j++)
+      for (size_t m = 0; m < d_W; m++)
+        d_bondState[i][j * d_W + m] = d_fracture[m]->getBondState(i, j);
+  }
+
+  // initial condition of members
+  for (size_t m = 0; m < d_W; m++) {
+    std::vector<util::Point3> u(nnodes, util::Point3());
+    std::vector<util::Point3> v(nnodes, util::Point3());
+    loading::InitialCondition(d_decks[m]->getInitialConditionDeck())
+        .apply(&u, &v, d_mesh_p);
+
+    for (size_t i = 0; i < nnodes; i++)
+      for (size_t d = 0; d < 3; d++) {
+        d_u[idx(i, d) + m] = u[i][d];
+        d_v[idx(i, d) + m] = v[i][d];
+      }
+  }
+
+  std::cout << "BatchFDModel: Number of members = " << d_W << "\n";
+}
+
+model::BatchFDModel::~BatchFDModel() {
+  delete d_uLoading_p;
+  for (auto *f : d_fLoading) delete f;
+  for (auto *f : d_fracture) delete f;
+}
+
+void model::BatchFDModel::initBonds(const material::pd::RNPBond &material) {
+  const size_t nnodes = d_mesh_p->getNumNodes();
+  const double horizon = material.getHorizon();
+  const double h = d_mesh_p->getMeshSize();
+
+  d_bondLength.resize(nnodes);
+  d_bondWeight.resize(nnodes);
+  d_bondVolume.resize(nnodes);
+  d_bondDir.resize(nnodes);
+
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, nnodes, [&](boost::uint64_t i) {
+        const auto &i_neighs = d_neighbor_p->getNeighbors(i);
+        auto xi = d_mesh_p->getNode(i);
+
+        d_bondLength[i].resize(i_neighs.size());
+        d_bondWeight[i].resize(i_neighs.size());
+        d_bondVolume[i].resize(i_neighs.size());
+        d_bondDir[i].resize(i_neighs.size());
+
+        for (size_t j = 0; j < i_neighs.size(); j++) {
+          auto xj = d_mesh_p->getNode(i_neighs[j]);
+          auto rji = xj.dist(xi);
+
+          // get corrected volume of node j
+          auto volj = d_mesh_p->getNodalVolume(i_neighs[j]);
+          if (util::compare::definitelyGreaterThan(rji, horizon - 0.5 * h))
+            volj *= (horizon + 0.5 * h - rji) / h;
+
+          d_bondLength[i][j] = rji;
+          d_bondVolume[i][j] = volj;
+          d_bondWeight[i][j] = material.getInfFn(rji) * volj;
+          d_bondDir[i][j] = (xj - xi) / rji;
+        }
+      });
+}
+
+void model::BatchFDModel::applyLoading() {
+  const size_t nnodes = d_mesh_p->getNumNodes();
+
+  // displacement boundary condition
+  std::vector<util::Point3> u(nnodes, util::Point3());
+  std::vector<util::Point3> v(nnodes, util::Point3());
+  d_uLoading_p->apply(d_time, &u, &v, d_mesh_p);
+
+  // force boundary condition of members
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, d_W, [this, nnodes](boost::uint64_t m) {
+        std::vector<util::Point3> f(nnodes, util::Point3());
+        d_fLoading[m]->apply(d_time, &f, d_mesh_p);
+
+        for (size_t i = 0; i < nnodes; i++)
+          for (size_t d = 0; d < 3; d++) d_fExt[idx(i, d) + m] = f[i][d];
+      });
+
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, nnodes, [this, &u, &v](boost::uint64_t i) {
+        for (size_t d = 0; d < d_dim; d++) {
+          if (d_mesh_p->isNodeFree(i, d)) continue;
+
+          for (size_t m = 0; m < d_W; m++) {
+            d_u[idx(i, d) + m] = u[i][d];
+            d_v[idx(i, d) + m] = v[i][d];
+          }
+        }
+      });
+}
+
+void model::BatchFDModel::computeForces(bool damage) {
+  util::ScopedTimer timer(util::Phase::Force);
+  size_t nbonds = 0;
+  for (const auto &neighs : d_neighbor_p->getNeighborsList())
+    nbonds += neighs.size();
+  util::Counters::addBondEvaluations(nbonds * d_W);
+
+  const size_t W = d_W;
+
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, d_mesh_p->getNumNodes(),
+      [this, W, damage](boost::uint64_t i) {
+        std::array<double, c_maxBatchSize> fx, fy, fz, z;
+        fx.fill(0.);
+        fy.fill(0.);
+        fz.fill(0.);
+        z.fill(0.);
+
+        const double *uix = &d_u[idx(i, 0)];
+        const double *uiy = &d_u[idx(i, 1)];
+        const double *uiz = &d_u[idx(i, 2)];
+        const auto voli = d_mesh_p->getNodalVolume(i);
+
+        const auto &i_neighs = d_neighbor_p->getNeighbors(i);
+        for (size_t j = 0; j < i_neighs.size(); j++) {
+          const auto j_id = i_neighs[j];
+          const double *ujx = &d_u[idx(j_id, 0)];
+          const double *ujy = &d_u[idx(j_id, 1)];
+          const double *ujz = &d_u[idx(j_id, 2)];
+
+          const auto rji = d_bondLength[i][j];
+          const auto w = d_bondWeight[i][j];
+          const auto e = d_bondDir[i][j];
+          const auto sqrt_r = std::sqrt(rji);
+          const bool break_bonds = d_canBreak[i] and d_canBreak[j_id];
+          uint8_t *fs = &d_bondState[i][j * W];
+
+          // same bond for all members
+          for (size_t m = 0; m < W; m++) {
+            const double s = (e.d_x * (ujx[m] - uix[m]) +
+                              e.d_y * (ujy[m] - uiy[m]) +
+                              e.d_z * (ujz[m] - uiz[m])) /
+                             rji;
+
+            if (break_bonds and d_irrev[m] and
+                std::abs(s) * sqrt_r > d_scFactor[m])
+              fs[m] = 1;
+
+            // bonds in no-fail region are linear
+            const double g =
+                break_bonds ? std::exp(-d_beta[m] * rji * s * s) : 1.;
+            const double fmag =
+                (break_bonds and fs[m]) ? 0. : w * d_forceFactor[m] * s * g;
+
+            fx[m] += fmag * e.d_x;
+            fy[m] += fmag * e.d_y;
+            fz[m] += fmag * e.d_z;
+
+            if (damage) z[m] = std::max(z[m], std::abs(s) * sqrt_r / d_rbar[m]);
+          }
+
+          // normal contact force between nodes of broken bond
+          if (d_contact and break_bonds) {
+            const auto volj = d_bondVolume[i][j];
+            for (size_t m = 0; m < W; m++) {
+              if (!fs[m]) continue;
+
+              auto yji = rji * e + util::Point3(ujx[m] - uix[m], ujy[m] - uiy[m],
+                                                ujz[m] - uiz[m]);
+              auto Rji = yji.length();
+              auto scalar_f = d_contactKn[m] * (voli * volj / (voli + volj)) *
+                              (d_contactRc - Rji) / Rji;
+              if (scalar_f > 0.) {
+                fx[m] -= scalar_f * yji.d_x;
+                fy[m] -= scalar_f * yji.d_y;
+                fz[m] -= scalar_f * yji.d_z;
+              }
+            }
+          }
+        }  // loop over neighboring nodes
+
+        for (size_t m = 0; m < W; m++) {
+          d_f[idx(i, 0) + m] = d_fExt[idx(i, 0) + m] + fx[m];
+          d_f[idx(i, 1) + m] = d_fExt[idx(i, 1) + m] + fy[m];
+          d_f[idx(i, 2) + m] = d_fExt[idx(i, 2) + m] + fz[m];
+        }
+
+        if (damage)
+          for (size_t m = 0; m < W; m++) d_Z[i * W + m] = z[m];
+      });
+}
+
+void model::BatchFDModel::integrateVerlet() {
+  const double delta_t = d_decks[0]->getModelDeck()->d_dt;
+
+  // step 1 and 2 : Compute v_mid and u_new
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, d_mesh_p->getNumNodes(),
+      [this, delta_t](boost::uint64_t i) {
+        for (size_t d = 0; d < d_dim; d++) {
+          if (!d_mesh_p->isNodeFree(i, d)) continue;
+
+          const auto k = idx(i, d);
+          for (size_t m = 0; m < d_W; m++) {
+            d_v[k + m] += 0.5 * delta_t * d_invDensity[m] * d_f[k + m];
+            d_u[k + m] += delta_t * d_v[k + m];
+          }
+        }
+      });
+
+  d_n++;
+  d_time += delta_t;
+
+  // every member completes a time step
+  util::Counters::updateSteps((d_n - 1) * d_W, d_n * d_W);
+
+  // boundary condition
+  applyLoading();
+
+  // compute forces due to new displacement field, damage is only needed for
+  // output
+  bool damage = false;
+  for (auto *deck : d_decks)
+    if (deck->getOutputDeck()->d_dtOut > 0 and
+        d_n % deck->getOutputDeck()->d_dtOut == 0 and
+        deck->getOutputDeck()->isTagInOutput(inp::OutputTag::Damage_Z))
+      damage = true;
+
+  computeForces(damage);
+
+  // Step 3: Compute v_new
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, d_mesh_p->getNumNodes(),
+      [this, delta_t](boost::uint64_t i) {
+        for (size_t d = 0; d < d_dim; d++) {
+          if (!d_mesh_p->isNodeFree(i, d)) continue;
+
+          const auto k = idx(i, d);
+          for (size_t m = 0; m < d_W; m++)
+            d_v[k + m] += 0.5 * delta_t * d_invDensity[m] * d_f[k + m];
+        }
+      });
+}
+
+void model::BatchFDModel::simulate() {
+  // apply loading and compute forces at initial time
+  applyLoading();
+  computeForces(true);
+  output();
+
+  const size_t N = d_decks[0]->getModelDeck()->d_Nt;
+  while (d_n < N) {
+    {
+      util::ScopedTimer timer(util::Phase::Integration);
+      integrateVerlet();
+    }
+
+    output();
+
+    // check for crack application
+    for (size_t m = 0; m < d_W; m++)
+      if (d_fracture[m]->addCrack(d_time, d_mesh_p->getNodesP(),
+                                  d_neighbor_p->getNeighborsListP()))
+        for (size_t i = 0; i < d_mesh_p->getNumNodes(); i++)
+          for (size_t j = 0; j < d_neighbor_p->getNeighbors(i).size(); j++)
+            if (d_fracture[m]->getBondState(i, j))
+              d_bondState[i][j * d_W + m] = 1;
+  }
+}
+
+std::vector<util::Point3> model::BatchFDModel::getDisplacement(
+    size_t m) const {
+  std::vector<util::Point3> u(d_mesh_p->getNumNodes(), util::Point3());
+  for (size_t i = 0; i < u.size(); i++)
+    for (size_t d = 0; d < d_dim; d++) u[i][d] = d_u[idx(i, d) + m];
+
+  return u;
+}
+
+void model::BatchFDModel::output() {
+  const size_t nnodes = d_mesh_p->getNumNodes();
+  bool written = false;
+
+  for (size_t m = 0; m < d_W; m++) {
+    auto *outputDeck = d_decks[m]->getOutputDeck();
+    if (outputDeck->d_dtOut == 0 or d_n % outputDeck->d_dtOut != 0) continue;
+
+    std::cout << "Output: member = " << m << ", time step = " << d_n << "\n";
+    util::ScopedTimer timer(util::Phase::Output);
+    written = true;
+
+    std::vector<util::Point3> u(nnodes, util::Point3());
+    std::vector<util::Point3> v(nnodes, util::Point3());
+    std::vector<util::Point3> f(nnodes, util::Point3());
+    std::vector<float> Z(nnodes, 0.);
+    for (size_t i = 0; i < nnodes; i++) {
+      for (size_t d = 0; d < 3; d++) {
+        u[i][d] = d_u[idx(i, d) + m];
+        v[i][d] = d_v[idx(i, d) + m];
+        f[i][d] = d_f[idx(i, d) + m] * d_mesh_p->getNodalVolume(i);
+      }
+      Z[i] = d_Z[i * d_W + m];
+    }
+
+    auto writer = rw::writer::Writer(
+        outputDeck->d_path + "output_" +
+            std::to_string(d_n / outputDeck->d_dtOutCriteria),
+        outputDeck->d_outFormat, outputDeck->d_compressType);
+
+    writer.appendNodes(d_mesh_p->getNodesP(), &u);
+
+    if (outputDeck->isTagInOutput(inp::OutputTag::Displacement))
+      writer.appendPointData("Displacement", &u);
+    if (outputDeck->isTagInOutput(inp::OutputTag::Velocity))
+      writer.appendPointData("Velocity", &v);
+    if (outputDeck->isTagInOutput(inp::OutputTag::Force))
+      writer.appendPointData("Force", &f);
+    if (outputDeck->isTagInOutput(inp::OutputTag::Damage_Z))
+      writer.appendPointData("Damage_Z", &Z);
+
+    writer.addTimeStep(d_time);
+    {
+      util::ScopedTimer writeTimer(util::Phase::OutputWrite);
+      writer.close();
+    }
+  }
+
+  if (written and util::Profiler::isEnabled())
+    util::Profiler::getInstance()->report(d_n, d_time);
+}
@@ -0,0 +1,240 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MODEL_BATCHFDMODEL_H
+#define MODEL_BATCHFDMODEL_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "util/point.h"  // definition of Point3
+
+// forward declaration of class
+namespace fe {
+class Mesh;
+} // namespace fe
+
+namespace geometry {
+class Fracture;
+class Neighbor;
+} // namespace geometry
+
+namespace inp {
+class Input;
+} // namespace inp
+
+namespace loading {
+class ULoading;
+class FLoading;
+} // namespace loading
+
+namespace material {
+namespace pd {
+class RNPBond;
+}
+} // namespace material
+
+namespace model {
+
+/**
+ * \addtogroup Explicit
+ */
+/**@{*/
+
+/*! @brief Maximum number of members integrated in lockstep by BatchFDModel */
+const size_t c_maxBatchSize = 16;
+
+/*! @brief A class to integrate a batch of ensemble members in lockstep
+ *
+ * The members share the mesh, the neighbor list, the displacement boundary
+ * condition, and the time step, and may differ in the parameters of the
+ * RNPBond material, the density, the force boundary condition, the initial
+ * condition, and the cracks. Nodal data is stored as [node][direction]
+ * [member], so that each bond is evaluated for all members in a loop over
+ * contiguous lanes which the compiler can vectorize. Bond length, direction
+ * and weight are computed once per bond for the whole batch, and the state
+ * of bonds is tracked per member.
+ *
+ * Time integration uses the velocity verlet scheme, see
+ * FDModel::integrateVerlet().
+ *
+ * @note Only the RNPBond material without dissipation is supported and the
+ * influence function has to be the same for all members. Absorbing layers,
+ * output criteria, and energy output are not supported.
+ */
+class BatchFDModel {
+
+public:
+  /*!
+   * @brief Constructor
+   * @param decks Input decks of the members
+   * @param mesh Shared mesh
+   * @param neighbor Shared neighbor list
+   * @param fracture Fracture object with the initial state of bonds
+   * @param copyFracture Flags per member if the initial state of bonds is
+   * copied from the fracture object
+   */
+  BatchFDModel(const std::vector<inp::Input *> &decks, fe::Mesh *mesh,
+               geometry::Neighbor *neighbor, const geometry::Fracture *fracture,
+               const std::vector<bool> &copyFracture);
+
+  ~BatchFDModel();
+
+  /*!
+   * @brief Integrates all members in time
+   */
+  void simulate();
+
+  /*!
+   * @brief Returns the number of members
+   * @return Number of members
+   */
+  size_t getBatchSize() const { return d_W; }
+
+  /*!
+   * @brief Returns the displacement of a member
+   * @param m Id of member
+   * @return Vector of displacement of nodes
+   */
+  std::vector<util::Point3> getDisplacement(size_t m) const;
+
+private:
+  /*!
+   * @brief Returns the index of the first lane of the given node and
+   * direction
+   * @param i Id of node
+   * @param d Direction
+   * @return Index
+   */
+  size_t idx(const size_t &i, const size_t &d) const {
+    return (3 * i + d) * d_W;
+  }
+
+  /*!
+   * @brief Initializes the bond data shared by all members
+   * @param material Material of the first member
+   */
+  void initBonds(const material::pd::RNPBond &material);
+
+  /*!
+   * @brief Applies displacement and force boundary conditions at current
+   * time
+   */
+  void applyLoading();
+
+  /*!
+   * @brief Computes the peridynamic force of all members
+   * @param damage If true compute damage Z of all members
+   */
+  void computeForces(bool damage);
+
+  /*!
+   * @brief Performs one time step of the velocity verlet scheme
+   */
+  void integrateVerlet();
+
+  /*!
+   * @brief Writes the output files of all members
+   */
+  void output();
+
+  /*! @brief Input decks of the members */
+  std::vector<inp::Input *> d_decks;
+
+  /*! @brief Shared mesh */
+  fe::Mesh *d_mesh_p;
+
+  /*! @brief Shared neighbor list */
+  geometry::Neighbor *d_neighbor_p;
+
+  /*! @brief Number of members */
+  size_t d_W;
+
+  /*! @brief Dimension */
+  size_t d_dim;
+
+  /*! @brief Current time step */
+  size_t d_n;
+
+  /*! @brief Current time */
+  double d_time;
+
+  /*! @brief Displacement, velocity, force and external force of members */
+  std::vector<double> d_u, d_v, d_f, d_fExt;
+
+  /*! @brief Damage Z of members */
+  std::vector<float> d_Z;
+
+  /*! @brief State of bonds of members, [node][neighbor][member] */
+  std::vector<std::vector<uint8_t>> d_bondState;
+
+  /*! @brief Reference length of bonds */
+  std::vector<std::vector<double>> d_bondLength;
+
+  /*! @brief Influence function times corrected volume of bonds */
+  std::vector<std::vector<double>> d_bondWeight;
+
+  /*! @brief Corrected volume of bonds for contact force */
+  std::vector<std::vector<double>> d_bondVolume;
+
+  /*! @brief Unit vector of bonds */
+  std::vector<std::vector<util::Point3>> d_bondDir;
+
+  /*! @brief Flag per node if its bonds can break */
+  std::vector<uint8_t> d_canBreak;
+
+  /**
+   * @name Parameters of members
+   */
+  /**@{*/
+
+  /*! @brief Factor of bond force */
+  std::array<double, c_maxBatchSize> d_forceFactor;
+
+  /*! @brief Parameter beta of bond potential */
+  std::array<double, c_maxBatchSize> d_beta;
+
+  /*! @brief Critical strain times square root of bond length for failure */
+  std::array<double, c_maxBatchSize> d_scFactor;
+
+  /*! @brief Critical strain times square root of bond length for damage */
+  std::array<double, c_maxBatchSize> d_rbar;
+
+  /*! @brief Flag if bonds can break */
+  std::array<uint8_t, c_maxBatchSize> d_irrev;
+
+  /*! @brief Contact force coefficient */
+  std::array<double, c_maxBatchSize> d_contactKn;
+
+  /*! @brief Inverse of density */
+  std::array<double, c_maxBatchSize> d_invDensity;
+
+  /** @}*/
+
+  /*! @brief Contact radius */
+  double d_contactRc;
+
+  /*! @brief Flag if contact is active for any member */
+  bool d_contact;
+
+  /*! @brief Shared displacement loading */
+  loading::ULoading *d_uLoading_p;
+
+  /*! @brief Force loading of members */
+  std::vector<loading::FLoading *> d_fLoading;
+
+  /*! @brief Fracture objects of members to apply cracks activated later */
+  std::vector<geometry::Fracture *> d_fracture;
+};
+
+/** @}*/
+
+} // namespace model
+
+#endif // MODEL_BATCHFDMODEL_H
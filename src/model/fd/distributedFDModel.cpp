@@ -0,0 +1,231 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include "distributedFDModel.h"
+
+#include <hpx/include/actions.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/serialization.hpp>
+
+#include <iostream>
+
+#include "fDModel.h"
+#include "fe/mesh.h"
+#include "geometry/neighbor.h"
+#include "geometry/partition.h"
+#include "inp/decks/materialDeck.h"
+#include "inp/decks/modelDeck.h"
+#include "inp/decks/outputDeck.h"
+#include "inp/input.h"
+#include "material/pd/rnpBond.h"
+
+using ghost_data = std::vector<double>;
+HPX_REGISTER_CHANNEL_DECLARATION(ghost_data);
+HPX_REGISTER_CHANNEL(ghost_data);
+
+namespace {
+
+/*! @brief Basename of channels receiving ghost nodes of partition */
+std::string getGhostBasename(size_t rank) {
+  return "/perihpx/ghost_to_" + std::to_string(rank);
+}
+
+/*! @brief Checks that the input is supported by the distributed model */
+void checkInput(inp::Input *deck) {
+  if (deck->getMaterialDeck()->d_materialType != "RNPBond") {
+    std::cerr << "Error: Distributed model requires RNPBond material.\n";
+    exit(1);
+  }
+
+  const auto *modelDeck = deck->getModelDeck();
+  if (modelDeck->d_timeDiscretization != "velocity_verlet" and
+      modelDeck->d_timeDiscretization != "central_difference") {
+    std::cerr << "Error: Distributed model supports only velocity_verlet and "
+                 "central_difference time discretization.\n";
+    exit(1);
+  }
+
+  if (modelDeck->d_numTiles > 0 or modelDeck->d_useStableDt) {
+    std::cerr << "Error: Distributed model does not support tiling and "
+                 "stable time step.\n";
+    exit(1);
+  }
+
+  if (deck->getMaterialDeck()->d_has_disserpation) {
+    std::cerr << "Error: Distributed model does not support dissipation "
+                 "since the velocity of ghost nodes is not exchanged.\n";
+    exit(1);
+  }
+
+  if (!deck->getOutputDeck()->d_outCriteria.empty()) {
+    std::cerr << "Error: Distributed model does not support output "
+                 "criteria.\n";
+    exit(1);
+  }
+}
+
+} // namespace
+
+namespace model {
+
+/*! @brief Runs the partition of this locality */
+void runPartition(const std::string &filename, const std::string &config,
+                  geometry::Partition partition, fe::Mesh mesh) {
+  auto *deck = new inp::Input(filename, config);
+  {
+    model::DistributedFDModel model(
+        deck, new geometry::Partition(std::move(partition)),
+        new fe::Mesh(std::move(mesh)));
+    model.simulate();
+  }
+  delete deck;
+}
+
+} // namespace model
+
+HPX_PLAIN_ACTION(model::runPartition, runPartition_action);
+
+model::DistributedFDModel::DistributedFDModel(inp::Input *deck,
+                                              geometry::Partition *partition,
+                                              fe::Mesh *mesh)
+    : d_partition_p(partition),
+      d_mesh_p(mesh),
+      d_neighbor_p(nullptr),
+      d_model_p(nullptr),
+      d_generation(0) {
+  checkInput(deck);
+
+  const auto *modelDeck = deck->getModelDeck();
+  const size_t rank = d_partition_p->getRank();
+  if (rank == 0) d_partition_p->print();
+
+  deck->getOutputDeck()->d_path += "locality_" + std::to_string(rank) + "_";
+
+  // ghost nodes have no bonds, their force is computed by the owner
+  const size_t nOwned = d_partition_p->getNumOwnedNodes();
+  d_neighbor_p = new geometry::Neighbor(
+      modelDeck->d_horizon, deck->getNeighborDeck(), d_mesh_p->getNodesP());
+  auto &list = d_neighbor_p->getNeighborsList();
+  for (size_t i = nOwned; i < list.size(); i++) {
+    list[i].clear();
+    list[i].shrink_to_fit();
+  }
+
+  std::vector<uint8_t> boundary(d_mesh_p->getNumNodes(), 0);
+  for (size_t i = 0; i < nOwned; i++)
+    for (auto j : list[i])
+      if (j >= nOwned) {
+        boundary[i] = 1;
+        break;
+      }
+
+  // ghost nodes are moved only by the exchange
+  for (size_t i = nOwned; i < d_mesh_p->getNumNodes(); i++)
+    for (unsigned int dof = 0; dof < 3; dof++)
+      d_mesh_p->setFixity(i, dof, true);
+
+  // channel of each neighboring partition is registered with the rank of
+  // sender as sequence number
+  const auto &parts = d_partition_p->getNeighborParts();
+  for (auto r : parts) {
+    d_recv.emplace_back(hpx::find_here());
+    hpx::register_with_basename(getGhostBasename(rank), d_recv.back(), r);
+  }
+  for (auto r : parts)
+    d_send.push_back(
+        hpx::find_from_basename<hpx::distributed::channel<ghost_data>>(
+            getGhostBasename(r), rank));
+
+  d_model_p = new FDModel<material::pd::RNPBond>(deck, d_mesh_p, d_neighbor_p,
+                                                 nullptr);
+  d_model_p->setGhostExchange([this]() { return this->exchangeGhosts(); },
+                              std::move(boundary));
+}
+
+model::DistributedFDModel::~DistributedFDModel() {
+  delete d_model_p;
+  delete d_neighbor_p;
+  delete d_mesh_p;
+  delete d_partition_p;
+}
+
+void model::DistributedFDModel::simulate() { d_model_p->simulate(); }
+
+hpx::future<void> model::DistributedFDModel::exchangeGhosts() {
+  const size_t gen = ++d_generation;
+  const auto &u = d_model_p->getDisplacement();
+
+  for (size_t k = 0; k < d_send.size(); k++) {
+    const auto &nodes = d_partition_p->getSendNodes(k);
+    ghost_data data(3 * nodes.size());
+    for (size_t n = 0; n < nodes.size(); n++)
+      for (size_t dof = 0; dof < 3; dof++)
+        data[3 * n + dof] = u[nodes[n]][dof];
+
+    d_send[k].set(hpx::launch::apply, std::move(data), gen);
+  }
+
+  std::vector<hpx::future<void>> fs;
+  fs.reserve(d_recv.size());
+  for (size_t k = 0; k < d_recv.size(); k++) {
+    auto range = d_partition_p->getRecvRange(k);
+    fs.push_back(d_recv[k].get(hpx::launch::async, gen)
+                     .then([this, range](hpx::future<ghost_data> f) {
+                       auto data = f.get();
+                       auto &u = this->d_model_p->getDisplacement();
+                       for (size_t i = range.first; i < range.second; i++)
+                         for (size_t dof = 0; dof < 3; dof++)
+                           u[i][dof] = data[3 * (i - range.first) + dof];
+                     }));
+  }
+
+  return hpx::when_all(fs).then([](auto &&) {});
+}
+
+void model::simulateDistributed(inp::Input *deck) {
+  checkInput(deck);
+
+  const auto localities = hpx::find_all_localities();
+  const size_t numParts = localities.size();
+  const size_t here = hpx::get_locality_id();
+  const std::string config = deck->getConfig();
+
+  // only this locality reads the full mesh, the other localities receive
+  // their owned and ghost nodes
+  std::vector<hpx::future<void>> fs;
+  geometry::Partition *partition = nullptr;
+  fe::Mesh *mesh = nullptr;
+  {
+    fe::Mesh full(deck->getMeshDeck());
+    const auto owner =
+        geometry::Partition::getOwners(numParts, full.getNodes());
+
+    for (const auto &id : localities) {
+      const size_t rank = hpx::naming::get_locality_id_from_id(id);
+      geometry::Partition part(numParts, rank, full.getNodes(),
+                               deck->getModelDeck()->d_horizon, owner);
+      fe::Mesh local(full, part.getGlobalIds());
+
+      if (rank == here) {
+        partition = new geometry::Partition(std::move(part));
+        mesh = new fe::Mesh(std::move(local));
+      } else
+        fs.push_back(hpx::async<runPartition_action>(
+            id, deck->getFilename(), config, std::move(part),
+            std::move(local)));
+    }
+  }
+
+  {
+    model::DistributedFDModel model(deck, partition, mesh);
+    model.simulate();
+  }
+
+  for (auto &f : fs) f.get();
+}
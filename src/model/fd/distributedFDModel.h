@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MODEL_DISTRIBUTEDFDMODEL_H
+#define MODEL_DISTRIBUTEDFDMODEL_H
+
+#include <hpx/include/lcos.hpp>
+
+#include <string>
+#include <vector>
+
+// forward declaration of class
+namespace fe {
+class Mesh;
+} // namespace fe
+
+namespace geometry {
+class Neighbor;
+class Partition;
+} // namespace geometry
+
+namespace inp {
+class Input;
+} // namespace inp
+
+namespace material {
+namespace pd {
+class RNPBond;
+}
+} // namespace material
+
+namespace model {
+
+template <class T> class FDModel;
+
+/*! @brief A class to run the explicit finite difference model on a
+ * partition of the nodes, one partition per locality
+ *
+ * Only the locality calling simulateDistributed() reads the mesh. It creates
+ * the geometry::Partition of the nodes for every locality and sends each
+ * locality only the nodes it owns and the ghost nodes within the horizon of
+ * its nodes. Thus, the full mesh is stored on a single locality, and mesh,
+ * neighbor list, bond states, and state vectors of the other localities
+ * only hold local nodes. Ghost nodes are fixed and have no bonds, their
+ * displacement
+ * is received from the owning locality through HPX channels before every
+ * force computation. The exchange is overlapped with the force computation
+ * of nodes without ghost neighbors, see FDModel::setGhostExchange().
+ *
+ * Output files are written per locality with prefix `locality_<rank>_` and
+ * contain owned and ghost nodes.
+ *
+ * @note Only the velocity verlet and central difference schemes with the
+ * RNPBond material and without dissipation are supported. Tiling, the
+ * stable time step, and output criteria are not supported since they
+ * require global reductions.
+ */
+class DistributedFDModel {
+
+public:
+  /*!
+   * @brief Constructor
+   *
+   * The model takes ownership of the partition and the mesh.
+   *
+   * @param deck The input deck
+   * @param partition Partition of this locality
+   * @param mesh Mesh of owned and ghost nodes of the partition, in the
+   * order of geometry::Partition::getGlobalIds()
+   */
+  DistributedFDModel(inp::Input *deck, geometry::Partition *partition,
+                     fe::Mesh *mesh);
+
+  ~DistributedFDModel();
+
+  /*!
+   * @brief Integrates the partition in time
+   */
+  void simulate();
+
+private:
+  /*!
+   * @brief Sends the displacement of owned nodes to the partitions holding
+   * them as ghosts and receives the displacement of ghost nodes
+   * @return future Future which is ready once ghost nodes are updated
+   */
+  hpx::future<void> exchangeGhosts();
+
+  /*! @brief Partition of nodes */
+  geometry::Partition *d_partition_p;
+
+  /*! @brief Mesh of local nodes */
+  fe::Mesh *d_mesh_p;
+
+  /*! @brief Neighbor list of local nodes */
+  geometry::Neighbor *d_neighbor_p;
+
+  /*! @brief Model of local nodes */
+  FDModel<material::pd::RNPBond> *d_model_p;
+
+  /*! @brief Channels to neighboring partitions */
+  std::vector<hpx::distributed::channel<std::vector<double>>> d_send;
+
+  /*! @brief Channels from neighboring partitions */
+  std::vector<hpx::distributed::channel<std::vector<double>>> d_recv;
+
+  /*! @brief Number of exchanges performed */
+  size_t d_generation;
+};
+
+/*!
+ * @brief Runs the model of the input deck on all localities
+ *
+ * Called on the console locality, which reads the mesh and sends the
+ * content of the input deck and the nodes of its partition to every other
+ * locality. Each locality creates DistributedFDModel for its partition and
+ * integrates it.
+ *
+ * @param deck The input deck
+ */
+void simulateDistributed(inp::Input *deck);
+
+} // namespace model
+
+#endif // MODEL_DISTRIBUTEDFDMODEL_H
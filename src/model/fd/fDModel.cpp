@@ -9,24 +9,32 @@
 #include "fDModel.h"
 
 #include "data/DataManager.h"
+#include "data/fieldRegistry.h"
 
 // utils
 #include "rw/reader.h"
 #include "rw/writer.h"
 #include "util/compare.h"
+#include "util/counters.h"
 #include "util/fastMethods.h"
 #include "util/matrix.h"
+#include "util/numa.h"
 #include "util/point.h"
+#include "util/profiler.h"
 #include "util/utilFunction.h"
 #include "util/utilGeom.h"
+#include "util/workPartitioner.h"
 
 // include high level class declarations
 #include "fe/massMatrix.h"
 #include "fe/mesh.h"
+#include "geometry/cellList.h"
 #include "geometry/dampingGeom.h"
 #include "geometry/fracture.h"
 #include "geometry/interiorFlags.h"
 #include "geometry/neighbor.h"
+#include "geometry/sparseFracture.h"
+#include "geometry/tiles.h"
 #include "inp/decks/absborbingCondDeck.h"
 #include "inp/decks/loadingDeck.h"
 #include "inp/decks/materialDeck.h"
@@ -43,22 +51,46 @@
 #include "model/util.h"
 
 // standard lib
+#include <hpx/include/lcos.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
 #include <fstream>
+#include <limits>
+#include <numeric>
 
 template <class T>
 model::FDModel<T>::FDModel(inp::Input *deck)
     : d_input_p(deck),
       d_policy_p(nullptr),
+      d_dataMask(0),
+      d_outMask(0),
       d_initialCondition_p(nullptr),
       d_material_p(nullptr),
       d_dampingGeom_p(nullptr),
-      d_stop(false) {
+      d_tiles_p(nullptr),
+      d_cellList_p(nullptr),
+      d_sparseFracture_p(nullptr),
+      d_finestLevel(0),
+      d_numBonds(0),
+      d_countedSteps(0),
+      d_countedBrokenBonds(0),
+      d_countedBondBytes(0),
+      d_partitioner_p(nullptr),
+      d_stop(false),
+      d_ownsMesh(true),
+      d_ownsNeighbor(true),
+      d_integrationStarted(false),
+      d_changedToSmall(false),
+      d_changedBackToLarge(false) {
   d_dataManager_p = new data::DataManager();
 
   d_dataManager_p->setModelDeckP(deck->getModelDeck());
   d_dataManager_p->setOutputDeckP(deck->getOutputDeck());
 
   d_policy_p = inp::Policy::getInstance(d_input_p->getPolicyDeck());
+  d_outMask = deck->getOutputDeck()->d_outMask;
   d_absorbingCondDeck_p = deck->getAbsorbingCondDeck();
 
   if (d_dataManager_p->getModelDeckP()->d_isRestartActive)
@@ -67,23 +99,72 @@ model::FDModel<T>::FDModel(inp::Input *deck)
     run(deck);
 }
 
+template <class T>
+model::FDModel<T>::FDModel(inp::Input *deck, fe::Mesh *mesh,
+                           geometry::Neighbor *neighbor,
+                           const geometry::Fracture *fracture)
+    : d_input_p(deck),
+      d_policy_p(nullptr),
+      d_dataMask(0),
+      d_outMask(0),
+      d_initialCondition_p(nullptr),
+      d_material_p(nullptr),
+      d_dampingGeom_p(nullptr),
+      d_tiles_p(nullptr),
+      d_cellList_p(nullptr),
+      d_sparseFracture_p(nullptr),
+      d_finestLevel(0),
+      d_numBonds(0),
+      d_countedSteps(0),
+      d_countedBrokenBonds(0),
+      d_countedBondBytes(0),
+      d_partitioner_p(nullptr),
+      d_stop(false),
+      d_ownsMesh(mesh == nullptr),
+      d_ownsNeighbor(neighbor == nullptr),
+      d_integrationStarted(false),
+      d_changedToSmall(false),
+      d_changedBackToLarge(false) {
+  d_dataManager_p = new data::DataManager();
+
+  d_dataManager_p->setModelDeckP(deck->getModelDeck());
+  d_dataManager_p->setOutputDeckP(deck->getOutputDeck());
+
+  d_policy_p = inp::Policy::getInstance(d_input_p->getPolicyDeck());
+  d_outMask = deck->getOutputDeck()->d_outMask;
+  d_absorbingCondDeck_p = deck->getAbsorbingCondDeck();
+
+  d_dataManager_p->setMeshP(mesh);
+  d_dataManager_p->setNeighborP(neighbor);
+  if (fracture != nullptr)
+    d_dataManager_p->setFractureP(
+        new geometry::Fracture(deck->getFractureDeck(), *fracture));
+
+  // first initialize all the high level data
+  initHObjects();
+
+  // now initialize remaining data
+  init();
+}
+
 template <class T>
 model::FDModel<T>::~FDModel() {
-  delete d_dataManager_p->getMeshP();
+  if (d_ownsMesh) delete d_dataManager_p->getMeshP();
+  if (d_ownsNeighbor) delete d_dataManager_p->getNeighborP();
   delete d_dataManager_p->getDisplacementLoadingP();
   delete d_dataManager_p->getForceLoadingP();
-  delete d_dataManager_p->getNeighborP();
   delete d_dataManager_p->getFractureP();
+  delete d_sparseFracture_p;
+  delete d_cellList_p;
   delete d_dataManager_p->getInteriorFlagsP();
-  delete d_dataManager_p->getDisplacementP();
-  delete d_dataManager_p->getVelocityP();
-  delete d_dataManager_p->getForceP();
   delete d_dataManager_p->getModelDeckP();
   delete d_dataManager_p->getOutputDeckP();
 
   delete d_material_p;
   delete d_initialCondition_p;
   delete d_dampingGeom_p;
+  delete d_tiles_p;
+  delete d_partitioner_p;
 
   delete d_dataManager_p;
 }
@@ -100,6 +181,60 @@ void model::FDModel<T>::run(inp::Input *deck) {
   integrate();
 }
 
+template <class T>
+void model::FDModel<T>::simulate() {
+  // integrate in time
+  integrate();
+}
+
+template <class T>
+void model::FDModel<T>::step(size_t n) {
+  if (!d_integrationStarted) initIntegrate();
+
+  size_t end = d_n + n;
+  while (d_n < end)
+    if (!integrateStep(end - d_n)) return;
+}
+
+template <class T>
+std::vector<util::Point3> &model::FDModel<T>::getDisplacement() {
+  return *d_dataManager_p->getDisplacementP();
+}
+
+template <class T>
+std::vector<util::Point3> &model::FDModel<T>::getVelocity() {
+  return *d_dataManager_p->getVelocityP();
+}
+
+template <class T>
+std::vector<util::Point3> &model::FDModel<T>::getForce() {
+  return *d_dataManager_p->getForceP();
+}
+
+template <class T>
+fe::Mesh *model::FDModel<T>::getMesh() {
+  return d_dataManager_p->getMeshP();
+}
+
+template <class T>
+void model::FDModel<T>::setGhostExchange(
+    std::function<hpx::future<void>()> exchange,
+    std::vector<uint8_t> boundary) {
+  d_ghostExchange = std::move(exchange);
+  d_ghostBoundary = std::move(boundary);
+}
+
+template <class T>
+double model::FDModel<T>::timeForces(size_t repeat) {
+  computeForces();  // warm up
+
+  std::uint64_t begin = hpx::chrono::high_resolution_clock::now();
+  for (size_t k = 0; k < repeat; k++) computeForces();
+  std::uint64_t time = hpx::chrono::high_resolution_clock::now() - begin;
+
+  return double(time) / 1.0e9 / double(std::max(repeat, size_t(1)));
+}
+
 template <class T>
 void model::FDModel<T>::restart(inp::Input *deck) {
   d_restartDeck_p = deck->getRestartDeck();
@@ -134,30 +269,132 @@ void model::FDModel<T>::restart(inp::Input *deck) {
 template <class T>
 void model::FDModel<T>::initHObjects() {
   std::cout << "FDModel: Initializing high level objects.\n";
-  // read mesh data
-  std::cout << "FDModel: Creating mesh.\n";
+  // read mesh data unless it is shared
+  if (d_dataManager_p->getMeshP() == nullptr) {
+    std::cout << "FDModel: Creating mesh.\n";
+
+    util::ScopedTimer timer(util::Phase::MeshRead);
+    d_dataManager_p->setMeshP(new fe::Mesh(d_input_p->getMeshDeck()));
+    d_dataManager_p->getMeshP()->clearElementData();
+
+    // place nodal data on the NUMA domains owning the nodes
+    util::Numa::getInstance()->distribute(
+        d_dataManager_p->getMeshP()->getNodes());
+    util::Numa::getInstance()->distribute(
+        d_dataManager_p->getMeshP()->getNodalVolumes());
+  }
 
-  d_dataManager_p->setMeshP(new fe::Mesh(d_input_p->getMeshDeck()));
-  d_dataManager_p->getMeshP()->clearElementData();
+  if (util::Numa::getInstance()->getNumDomains() > 1)
+    std::cout << "FDModel: Number of NUMA domains = "
+              << util::Numa::getInstance()->getNumDomains() << "\n";
 
   std::cout << "number of nodes = "
             << d_dataManager_p->getMeshP()->getNumNodes()
             << " number of elements = "
             << d_dataManager_p->getMeshP()->getNumElements() << "\n";
 
-  // create neighbor list
-  std::cout << "FDModel: Creating neighbor list.\n";
+  // at the highest memory control level the bonds are not stored but
+  // enumerated on the fly from a cell list
+  if (d_dataManager_p->getNeighborP() == nullptr and
+      d_dataManager_p->getFractureP() == nullptr and
+      !d_policy_p->populateData(inp::PolicyTag::Neighbor_d_list)) {
+    const auto *modelDeck = d_dataManager_p->getModelDeckP();
+    if (modelDeck->d_timeDiscretization != "velocity_verlet" and
+        modelDeck->d_timeDiscretization != "central_difference") {
+      std::cerr << "Error: Memory control level 4 supports only "
+                   "velocity_verlet and central_difference time "
+                   "discretization.\n";
+      exit(1);
+    }
+
+    if (modelDeck->d_numTiles > 0 or modelDeck->d_useStableDt or
+        modelDeck->d_workPartition) {
+      std::cerr << "Error: Memory control level 4 does not support tiling, "
+                   "stable time step, and work partitioning.\n";
+      exit(1);
+    }
 
-  d_dataManager_p->setNeighborP(new geometry::Neighbor(
-      d_dataManager_p->getModelDeckP()->d_horizon, d_input_p->getNeighborDeck(),
-      d_dataManager_p->getMeshP()->getNodesP()));
+    if (d_input_p->getMaterialDeck()->d_has_disserpation) {
+      std::cerr << "Error: Memory control level 4 does not support "
+                   "dissipation.\n";
+      exit(1);
+    }
 
-  // create fracture data
-  std::cout << "FDModel: Creating edge crack if any and modifying the "
-               "fracture state of bonds.\n";
-  d_dataManager_p->setFractureP(new geometry::Fracture(
-      d_input_p->getFractureDeck(), d_dataManager_p->getMeshP()->getNodesP(),
-      d_dataManager_p->getNeighborP()->getNeighborsListP()));
+    const auto *outputDeck = d_dataManager_p->getOutputDeckP();
+    if (outputDeck->isTagInOutput(inp::OutputTag::Neighbors) or
+        outputDeck->isTagInOutput(inp::OutputTag::Neighbors_Crack) or
+        outputDeck->isTagInOutput(inp::OutputTag::Broken_Bonds)) {
+      std::cerr << "Error: Memory control level 4 does not support output "
+                   "tags Neighbors, Neighbors_Crack, and Broken_Bonds.\n";
+      exit(1);
+    }
+
+    std::cout << "FDModel: Creating cell list to enumerate bonds on the "
+                 "fly.\n";
+    const size_t nnodes = d_dataManager_p->getMeshP()->getNumNodes();
+    {
+      util::ScopedTimer timer(util::Phase::NeighborBuild);
+      d_cellList_p = new geometry::CellList(
+          d_dataManager_p->getModelDeckP()->d_horizon,
+          d_dataManager_p->getMeshP()->getNodesP());
+    }
+    d_cellList_p->print();
+
+    std::vector<size_t> nbonds(nnodes, 0);
+    util::Numa::getInstance()->forLoop(nnodes, [&](boost::uint64_t i) {
+      nbonds[i] = this->d_cellList_p->getNumNeighbors(i);
+    });
+    d_numBonds = std::accumulate(nbonds.begin(), nbonds.end(), size_t(0));
+
+    std::cout << "FDModel: Creating edge crack if any and modifying the "
+                 "fracture state of bonds.\n";
+    {
+      util::ScopedTimer timer(util::Phase::FractureInit);
+      d_sparseFracture_p = new geometry::SparseFracture(
+          d_input_p->getFractureDeck(),
+          d_dataManager_p->getMeshP()->getNodesP(), d_cellList_p);
+    }
+
+    // memory of cell list and broken bonds
+    reportBondBytes(d_cellList_p->getBytes() + d_sparseFracture_p->getBytes());
+  } else {
+    // create neighbor list unless it is shared
+    if (d_dataManager_p->getNeighborP() == nullptr) {
+      std::cout << "FDModel: Creating neighbor list.\n";
+
+      util::ScopedTimer timer(util::Phase::NeighborBuild);
+      d_dataManager_p->setNeighborP(new geometry::Neighbor(
+          d_dataManager_p->getModelDeckP()->d_horizon,
+          d_input_p->getNeighborDeck(),
+          d_dataManager_p->getMeshP()->getNodesP()));
+      util::Numa::getInstance()->distribute(
+          d_dataManager_p->getNeighborP()->getNeighborsList());
+    }
+
+    for (const auto &neighs :
+         d_dataManager_p->getNeighborP()->getNeighborsList())
+      d_numBonds += neighs.size();
+
+    // create fracture data unless it is copied from a reference
+    if (d_dataManager_p->getFractureP() == nullptr) {
+      std::cout << "FDModel: Creating edge crack if any and modifying the "
+                   "fracture state of bonds.\n";
+      util::ScopedTimer timer(util::Phase::FractureInit);
+      d_dataManager_p->setFractureP(new geometry::Fracture(
+          d_input_p->getFractureDeck(),
+          d_dataManager_p->getMeshP()->getNodesP(),
+          d_dataManager_p->getNeighborP()->getNeighborsListP()));
+    }
+
+    // memory of neighbor ids, counted by the owner of the neighbor list, and
+    // bond states (one bit per bond)
+    std::uint64_t bytes = 0;
+    for (const auto &neighs :
+         d_dataManager_p->getNeighborP()->getNeighborsList())
+      bytes += (d_ownsNeighbor ? neighs.capacity() * sizeof(size_t) : 0) +
+               (neighs.size() + 7) / 8;
+    reportBondBytes(bytes);
+  }
 
   // create interior flags
   std::cout << "FDModel: Creating interior flags for nodes.\n";
@@ -181,7 +418,10 @@ void model::FDModel<T>::initHObjects() {
 
   // initialize material class
   std::cout << "FDModel: Initializing material object.\n";
-  d_material_p = new T(d_input_p->getMaterialDeck(), d_dataManager_p);
+  {
+    util::ScopedTimer timer(util::Phase::MaterialInit);
+    d_material_p = new T(d_input_p->getMaterialDeck(), d_dataManager_p);
+  }
 
   // initialize damping geometry class
   std::cout << "FDModel: Initializing damping object.\n";
@@ -190,6 +430,9 @@ void model::FDModel<T>::initHObjects() {
 
   std::cout << "FDModel: Has disserpation: "
             << d_input_p->getMaterialDeck()->d_has_disserpation << std::endl;
+
+  // decompose nodes into tiles for tiled time stepping
+  if (d_dataManager_p->getModelDeckP()->d_numTiles > 0) initTiles();
 }
 
 template <class T>
@@ -202,28 +445,32 @@ void model::FDModel<T>::init() {
   // get number of nodes, total number of dofs (fixed and free together)
   size_t nnodes = d_dataManager_p->getMeshP()->getNumNodes();
 
+  // fields are owned by the data manager and their pages are placed on the
+  // owning NUMA domains
+  auto &fields = d_dataManager_p->getFields();
+  const auto output = data::FieldLifetime::Output;
+
   // initialize major simulation data
   d_dataManager_p->setDisplacementP(
-      new std::vector<util::Point3>(nnodes, util::Point3()));
+      fields.add("Displacement", nnodes, util::Point3()));
   d_dataManager_p->setVelocityP(
-      new std::vector<util::Point3>(nnodes, util::Point3()));
+      fields.add("Velocity", nnodes, util::Point3()));
   d_dataManager_p->setForceP(
-      new std::vector<util::Point3>(nnodes, util::Point3()));
+      fields.add("Force", nnodes, util::Point3()));
 
   // Allocate the reaction force vector
-  if (d_dataManager_p->getOutputDeckP()->isTagInOutput("Reaction_Force") or
-      d_dataManager_p->getOutputDeckP()->isTagInOutput(
-          "Total_Reaction_Force")) {
+  if (isTagInOutput(inp::OutputTag::Reaction_Force) or
+      isTagInOutput(inp::OutputTag::Total_Reaction_Force)) {
     d_dataManager_p->setReactionForceP(
-        new std::vector<util::Point3>(nnodes, util::Point3()));
+        fields.add("Reaction_Force", nnodes, util::Point3(), output));
     d_dataManager_p->setTotalReactionForceP(
-        new std::vector<double>(nnodes, 0.));
+        fields.add("Total_Reaction_Force", nnodes, 0., output));
   }
 
   // initialize minor simulation data
   if (this->d_policy_p->populateData("Model_d_e"))
     d_dataManager_p->setKineticEnergyP(
-        new std::vector<float>(d_dataManager_p->getMeshP()->getNumNodes(), 0.));
+        fields.add("Kinetic_Energy", nnodes, 0.f, output));
 
   if (d_policy_p->enablePostProcessing()) {
     std::string tag = "Strain_Energy";
@@ -231,7 +478,8 @@ void model::FDModel<T>::init() {
       // this data is asked in output file
       // but check if policy allows its population
       if (d_policy_p->populateData("Model_d_e"))
-        d_dataManager_p->setStrainEnergyP(new std::vector<float>(nnodes, 0.0));
+        d_dataManager_p->setStrainEnergyP(
+            fields.add("Strain_Energy", nnodes, 0.f, output));
     } else {
       // this data is not asked in output thus we disable it
       d_policy_p->addToTags(0, "Model_d_e");
@@ -240,14 +488,15 @@ void model::FDModel<T>::init() {
     tag = "Work_Done";
     if (d_dataManager_p->getOutputDeckP()->isTagInOutput(tag)) {
       if (d_policy_p->populateData("Model_d_w"))
-        d_dataManager_p->setWorkDoneP(new std::vector<float>(nnodes, 0.0));
+        d_dataManager_p->setWorkDoneP(
+            fields.add("Work_Done", nnodes, 0.f, output));
     } else
       d_policy_p->addToTags(0, "Model_d_w");
 
     tag = "Damage_Phi";
     if (d_dataManager_p->getOutputDeckP()->isTagInOutput(tag)) {
       if (d_policy_p->populateData("Model_d_phi"))
-        d_dataManager_p->setPhiP(new std::vector<float>(nnodes, 0.0));
+        d_dataManager_p->setPhiP(fields.add("Damage_Phi", nnodes, 0.f, output));
     } else
       d_policy_p->addToTags(0, "Model_d_phi");
 
@@ -255,7 +504,7 @@ void model::FDModel<T>::init() {
     if (d_dataManager_p->getOutputDeckP()->isTagInOutput(tag)) {
       if (d_policy_p->populateData("Model_d_Z"))
         d_dataManager_p->setDamageFunctionP(
-            new std::vector<float>(nnodes, 0.0));
+            fields.add("Damage_Z", nnodes, 0.f, output));
     } else
       d_policy_p->addToTags(0, "Model_d_Z");
 
@@ -263,16 +512,16 @@ void model::FDModel<T>::init() {
     if (d_dataManager_p->getOutputDeckP()->isTagInOutput(tag)) {
       if (d_policy_p->populateData("Model_d_eF"))
 
-        d_dataManager_p->setFractureEnergyP(
-            new std::vector<float>(nnodes, 0.0));
+        d_dataManager_p->setFractureEnergyP(fields.add(
+            "Fracture_Perienergy_Total", nnodes, 0.f, output));
     } else
       d_policy_p->addToTags(0, "Model_d_eF");
 
     tag = "Fracture_Perienergy_Bond";
     if (d_dataManager_p->getOutputDeckP()->isTagInOutput(tag)) {
       if (d_policy_p->populateData("Model_d_eFB"))
-        d_dataManager_p->setBBFractureEnergyP(
-            new std::vector<float>(nnodes, 0.0));
+        d_dataManager_p->setBBFractureEnergyP(fields.add(
+            "Fracture_Perienergy_Bond", nnodes, 0.f, output));
     } else
       d_policy_p->addToTags(0, "Model_d_eFB");
   }
@@ -303,11 +552,10 @@ void model::FDModel<T>::init() {
       d_dataManager_p->getOutputDeckP()->d_outCriteria.clear();
     } else {
       // check if damage data is allocated
-      if ((*d_dataManager_p->getDamageFunctionP()).size() !=
-          d_dataManager_p->getMeshP()->getNumNodes()) {
+      if (!fields.has("Damage_Z")) {
         // allocate data
         d_dataManager_p->setDamageFunctionP(
-            new std::vector<float>(nnodes, 0.0));
+            fields.add("Damage_Z", nnodes, 0.f, output));
 
         // check if damage data is allowed in policy class (if not, need to
         // allow it by removing the tag related to damage function Z)
@@ -316,10 +564,188 @@ void model::FDModel<T>::init() {
       }
     }
   }  // handle output criteria exceptions
+
+  // tags are not modified after this point
+  d_dataMask = d_policy_p->getDataMask();
+
+  fields.print();
+
+  // balance the bond work of node loops
+  if (d_dataManager_p->getModelDeckP()->d_workPartition) initWorkPartition();
+
+  // estimate the stable time step of the explicit schemes
+  if (d_dataManager_p->getModelDeckP()->d_timeDiscretization ==
+          "central_difference" or
+      d_dataManager_p->getModelDeckP()->d_timeDiscretization ==
+          "velocity_verlet" or
+      d_dataManager_p->getModelDeckP()->d_timeDiscretization ==
+          "multirate_verlet")
+    initTimeStep();
+}
+
+template <class T>
+void model::FDModel<T>::initTimeStep() {
+  auto *modelDeck = d_dataManager_p->getModelDeckP();
+  const size_t nnodes = d_dataManager_p->getMeshP()->getNumNodes();
+  const double rho = d_material_p->getDensity();
+  const double safety = modelDeck->d_dtSafetyFactor;
+
+  // for the multirate scheme the finest level has to be stable
+  bool multirate = modelDeck->d_timeDiscretization == "multirate_verlet";
+  double level_factor =
+      multirate ? double(size_t(1) << modelDeck->d_maxTimeLevel) : 1.;
+
+  d_dtCrit.resize(nnodes);
+  auto f = hpx::experimental::for_loop(
+      hpx::execution::par(hpx::execution::task), 0, nnodes,
+      [this, rho](boost::uint64_t i) {
+        double k = 0.;
+        if (this->d_cellList_p != nullptr)
+          this->d_cellList_p->forEachNeighbor(i, [&](size_t j_id) {
+            k += std::abs(this->d_material_p->getBondStiffness(
+                i, j_id, this->d_sparseFracture_p->getBondState(i, j_id)));
+          });
+        else {
+          const auto &i_neighs =
+              this->d_dataManager_p->getNeighborP()->getNeighbors(i);
+          for (size_t j = 0; j < i_neighs.size(); j++)
+            k += std::abs(this->d_material_p->getBondStiffness(i, j));
+        }
+
+        this->d_dtCrit[i] = k > 0. ? std::sqrt(2. * rho / k)
+                                   : std::numeric_limits<double>::max();
+      });
+  f.get();
+
+  // selective mass scaling of the nodes limiting the time step
+  if (modelDeck->d_maxAddedMass > 0.) {
+    auto target = modelDeck->d_dt / (safety * level_factor);
+    auto max_scale = 1. + modelDeck->d_maxAddedMass;
+    std::vector<double> added_mass(nnodes, 0.);
+    std::vector<double> mass(nnodes, 0.);
+
+    d_density = std::vector<double>(nnodes, rho);
+    f = hpx::experimental::for_loop(
+        hpx::execution::par(hpx::execution::task), 0, nnodes,
+        [this, rho, target, max_scale, &added_mass,
+         &mass](boost::uint64_t i) {
+          auto vol = this->d_dataManager_p->getMeshP()->getNodalVolume(i);
+          mass[i] = rho * vol;
+
+          if (this->d_dtCrit[i] >= target) return;
+
+          auto scale = std::min(std::pow(target / this->d_dtCrit[i], 2),
+                                max_scale);
+          this->d_density[i] = scale * rho;
+          this->d_dtCrit[i] *= std::sqrt(scale);
+          added_mass[i] = (scale - 1.) * rho * vol;
+        });
+    f.get();
+
+    size_t num_scaled = std::count_if(added_mass.begin(), added_mass.end(),
+                                      [](double m) { return m > 0.; });
+    if (num_scaled == 0)
+      d_density.clear();
+    else
+      std::cout << "FDModel: Mass scaling applied to " << num_scaled
+                << " nodes. Added mass = "
+                << 100. * util::methods::add(added_mass) /
+                       util::methods::add(mass)
+                << "% of total mass.\n";
+  }
+
+  size_t i_min = 0;
+  auto dt_stable = safety * util::methods::min(d_dtCrit, &i_min);
+  std::cout << "FDModel: Stable time step = " << dt_stable
+            << " (limited by node " << i_min
+            << "), time step = " << modelDeck->d_dt << ".\n";
+
+  if (modelDeck->d_useStableDt) {
+    auto nt_old = modelDeck->d_Nt;
+    modelDeck->d_Nt = size_t(
+        std::ceil(modelDeck->d_tFinal / (level_factor * dt_stable)));
+    modelDeck->d_dt = modelDeck->d_tFinal / double(modelDeck->d_Nt);
+    std::cout << "FDModel: Using time step = " << modelDeck->d_dt
+              << " and number of time steps = " << modelDeck->d_Nt << ".\n";
+
+    // intervals counted in steps keep their duration in time
+    auto ratio = double(modelDeck->d_Nt) / double(nt_old);
+    auto rescale = [ratio](size_t &steps) {
+      if (steps > 0)
+        steps = std::max(size_t(1), size_t(std::round(ratio * steps)));
+    };
+    auto *outputDeck = d_dataManager_p->getOutputDeckP();
+    rescale(outputDeck->d_dtOut);
+    rescale(outputDeck->d_dtOutOld);
+    rescale(outputDeck->d_dtOutCriteria);
+    rescale(modelDeck->d_RelaxN);
+    std::cout << "FDModel: Using output interval = " << outputDeck->d_dtOut
+              << " and relaxation steps = " << modelDeck->d_RelaxN << ".\n";
+  } else if (modelDeck->d_dt > level_factor * dt_stable)
+    std::cout << "Warning: Time step " << modelDeck->d_dt
+              << " is larger than the stable time step "
+              << level_factor * dt_stable
+              << ". The simulation may become unstable.\n";
+
+  if (!multirate) return;
+
+  // assign time step levels
+  d_level.resize(nnodes);
+  d_extForce.resize(nnodes);
+  auto dt = modelDeck->d_dt;
+  auto max_level = modelDeck->d_maxTimeLevel;
+  f = hpx::experimental::for_loop(
+      hpx::execution::par(hpx::execution::task), 0, nnodes,
+      [this, dt, safety, max_level](boost::uint64_t i) {
+        size_t l = 0;
+        while (l < max_level && dt / double(size_t(1) << l) >
+                                    safety * this->d_dtCrit[i])
+          l++;
+        this->d_level[i] = l;
+      });
+  f.get();
+
+  d_finestLevel = *std::max_element(d_level.begin(), d_level.end());
+
+  // report the distribution of levels and the saving in force evaluations
+  std::vector<size_t> num_nodes(d_finestLevel + 1, 0);
+  double work = 0.;
+  for (const auto &l : d_level) {
+    num_nodes[l]++;
+    work += double(size_t(1) << l);
+  }
+
+  std::cout << "FDModel: Multirate time step levels:\n";
+  for (size_t l = 0; l <= d_finestLevel; l++)
+    std::cout << "  level " << l << ": time step = "
+              << dt / double(size_t(1) << l) << ", nodes = " << num_nodes[l]
+              << "\n";
+  std::cout << "FDModel: Force evaluations reduced by factor "
+            << double(nnodes) * double(size_t(1) << d_finestLevel) / work
+            << " compared to a single rate scheme.\n";
 }
 
 template <class T>
 void model::FDModel<T>::integrate() {
+  initIntegrate();
+
+  // start time integration
+  size_t N = d_dataManager_p->getModelDeckP()->d_Nt +
+             d_dataManager_p->getModelDeckP()->d_RelaxN;
+
+  // every step of dynamic relaxation is already relaxed
+  if (d_dataManager_p->getModelDeckP()->d_timeDiscretization ==
+      "dynamic_relaxation")
+    N = d_dataManager_p->getModelDeckP()->d_Nt;
+
+  while (d_n < N)
+    if (!integrateStep(N - d_n)) return;
+}
+
+template <class T>
+void model::FDModel<T>::initIntegrate() {
+  d_integrationStarted = true;
+
   // apply initial loading
   if (d_n == 0)
     d_initialCondition_p->apply(d_dataManager_p->getDisplacementP(),
@@ -340,55 +766,97 @@ void model::FDModel<T>::integrate() {
   if (d_n == 0) {
     if (d_policy_p->enablePostProcessing()) computePostProcFields();
 
+    reportBrokenBonds(countBrokenBonds());
+
     model::Output(d_input_p, d_dataManager_p, d_n, d_time);
   }
+}
 
-  // start time integration
-  size_t i = d_n;
-  size_t N = d_dataManager_p->getModelDeckP()->d_Nt +
-             d_dataManager_p->getModelDeckP()->d_RelaxN;
+template <class T>
+void model::FDModel<T>::reportBrokenBonds(size_t n) {
+  util::Counters::updateBrokenBonds(d_countedBrokenBonds, n);
+  d_countedBrokenBonds = n;
+}
 
-  for (i; i < N; i++) {
-    if (d_dataManager_p->getModelDeckP()->d_timeDiscretization ==
-        "central_difference")
+template <class T>
+void model::FDModel<T>::reportBondBytes(size_t n) {
+  util::Counters::updateBondBytes(d_countedBondBytes, n);
+  d_countedBondBytes = n;
+}
+
+template <class T>
+bool model::FDModel<T>::integrateStep(size_t maxSteps) {
+  {
+    util::ScopedTimer timer(util::Phase::Integration);
+    const size_t timeBlock = d_dataManager_p->getModelDeckP()->d_timeBlock;
+    if (timeBlock > 1) maxSteps = std::min(maxSteps, timeBlock);
+
+    size_t tiledSteps = d_tiles_p != nullptr ? getTiledSteps(maxSteps) : 0;
+    if (tiledSteps > 0 and timeBlock > 1)
+      integrateWavefront(tiledSteps);
+    else if (tiledSteps > 0)
+      integrateTiled(tiledSteps);
+    else if (d_dataManager_p->getModelDeckP()->d_timeDiscretization ==
+             "central_difference")
       integrateCD();
     else if (d_dataManager_p->getModelDeckP()->d_timeDiscretization ==
              "velocity_verlet")
       integrateVerlet();
+    else if (d_dataManager_p->getModelDeckP()->d_timeDiscretization ==
+             "dynamic_relaxation")
+      integrateDR();
+    else if (d_dataManager_p->getModelDeckP()->d_timeDiscretization ==
+             "multirate_verlet")
+      integrateMultirate();
+  }
+
+  util::Counters::updateSteps(d_countedSteps, d_n);
+  d_countedSteps = d_n;
 
-    // handle general output
-    if ((d_n % d_dataManager_p->getOutputDeckP()->d_dtOut == 0) &&
-        (d_n >= d_dataManager_p->getOutputDeckP()->d_dtOut)) {
-      if (d_policy_p->enablePostProcessing()) computePostProcFields();
+  // handle general output
+  if ((d_n % d_dataManager_p->getOutputDeckP()->d_dtOut == 0) &&
+      (d_n >= d_dataManager_p->getOutputDeckP()->d_dtOut)) {
+    if (d_policy_p->enablePostProcessing()) computePostProcFields();
 
-      model::Output(d_input_p, d_dataManager_p, d_n, d_time);
+    reportBrokenBonds(countBrokenBonds());
 
-      // exit early if output criteria has changed the d_stop flag to true
-      if (d_stop) return;
+    model::Output(d_input_p, d_dataManager_p, d_n, d_time);
 
-      // check if we need to modify the output frequency
-      checkOutputCriteria();
-    }
+    // exit early if output criteria has changed the d_stop flag to true
+    if (d_stop) return false;
 
-    // check for crack application
-    if (d_dataManager_p->getFractureP()->addCrack(
-            d_time, d_dataManager_p->getMeshP()->getNodesP(),
-            d_dataManager_p->getNeighborP()->getNeighborsListP())) {
-      // check if we need to modify the output frequency
-      checkOutputCriteria();
-    }
-  }  // loop over time steps
+    // check if we need to modify the output frequency
+    checkOutputCriteria();
+  }
+
+  // check for crack application
+  const bool added =
+      d_cellList_p != nullptr
+          ? d_sparseFracture_p->addCrack(
+                d_time, d_dataManager_p->getMeshP()->getNodesP(),
+                d_cellList_p)
+          : d_dataManager_p->getFractureP()->addCrack(
+                d_time, d_dataManager_p->getMeshP()->getNodesP(),
+                d_dataManager_p->getNeighborP()->getNeighborsListP());
+  if (added) {
+    // check if we need to modify the output frequency
+    checkOutputCriteria();
+
+    // bonds broken since last output change the cost of nodes
+    if (d_partitioner_p != nullptr) updateWorkPartition();
+  }
+
+  return true;
 }
 
 template <class T>
 void model::FDModel<T>::integrateCD() {
-  // parallel for loop
-  auto f = hpx::experimental::for_loop(
-      hpx::execution::par(hpx::execution::task), 0,
+  // parallel for loop on the NUMA domains owning the nodes
+  util::Numa::getInstance()->forLoop(
       d_dataManager_p->getMeshP()->getNumNodes(), [this](boost::uint64_t i) {
         auto dim = this->d_dataManager_p->getMeshP()->getDimension();
         auto delta_t = this->d_dataManager_p->getModelDeckP()->d_dt;
-        auto fact = delta_t * delta_t / this->d_material_p->getDensity();
+        auto fact = delta_t * delta_t / this->getDensity(i);
 
         if (this->d_dataManager_p->getMeshP()->isNodeFree(i, 0)) {
           auto u_old = (*d_dataManager_p->getDisplacementP())[i].d_x;
@@ -431,8 +899,6 @@ void model::FDModel<T>::integrateCD() {
         (*this->d_dataManager_p->getForceP())[i] = util::Point3();
       });  // end of parallel for loop
 
-  f.get();
-
   // compute forces and energy due to new displacement field (this will be
   // used in next time step)
   d_n++;
@@ -462,44 +928,45 @@ void model::FDModel<T>::integrateCD() {
 }
 
 template <class T>
-void model::FDModel<T>::integrateVerlet() {
-  // step 1 and 2 : Compute v_mid and u_new
-  auto f = hpx::experimental::for_loop(
-      hpx::execution::par(hpx::execution::task), 0,
-      d_dataManager_p->getMeshP()->getNumNodes(), [this](boost::uint64_t i) {
-        auto dim = this->d_dataManager_p->getMeshP()->getDimension();
-        auto delta_t = this->d_dataManager_p->getModelDeckP()->d_dt;
-        auto fact = 0.5 * delta_t / this->d_material_p->getDensity();
+void model::FDModel<T>::verletKickDrift(const size_t &i) {
+  auto dim = d_dataManager_p->getMeshP()->getDimension();
+  auto delta_t = d_dataManager_p->getModelDeckP()->d_dt;
+  auto fact = 0.5 * delta_t / getDensity(i);
+
+  auto &u = (*d_dataManager_p->getDisplacementP())[i];
+  auto &v = (*d_dataManager_p->getVelocityP())[i];
+  auto &f = (*d_dataManager_p->getForceP())[i];
+
+  // modify dofs which are not marked fixed
+  for (size_t d = 0; d < dim; d++)
+    if (d_dataManager_p->getMeshP()->isNodeFree(i, d)) {
+      v[d] += fact * f[d];
+      u[d] += delta_t * v[d];
+    }
 
-        // modify dofs which are not marked fixed
-        if (this->d_dataManager_p->getMeshP()->isNodeFree(i, 0)) {
-          (*d_dataManager_p->getVelocityP())[i].d_x +=
-              fact * (*this->d_dataManager_p->getForceP())[i].d_x;
-          (*d_dataManager_p->getDisplacementP())[i].d_x +=
-              delta_t * (*d_dataManager_p->getVelocityP())[i].d_x;
-        }
+  // reset force
+  f = util::Point3();
+}
 
-        if (dim > 1)
-          if (this->d_dataManager_p->getMeshP()->isNodeFree(i, 1)) {
-            (*d_dataManager_p->getVelocityP())[i].d_y +=
-                fact * (*this->d_dataManager_p->getForceP())[i].d_y;
-            (*d_dataManager_p->getDisplacementP())[i].d_y +=
-                delta_t * (*d_dataManager_p->getVelocityP())[i].d_y;
-          }
+template <class T>
+void model::FDModel<T>::verletKick(const size_t &i) {
+  auto dim = d_dataManager_p->getMeshP()->getDimension();
+  auto fact = 0.5 * d_dataManager_p->getModelDeckP()->d_dt / getDensity(i);
 
-        if (dim > 2)
-          if (this->d_dataManager_p->getMeshP()->isNodeFree(i, 2)) {
-            (*d_dataManager_p->getVelocityP())[i].d_z +=
-                fact * (*this->d_dataManager_p->getForceP())[i].d_z;
-            (*d_dataManager_p->getDisplacementP())[i].d_z +=
-                delta_t * (*d_dataManager_p->getVelocityP())[i].d_z;
-          }
+  auto &v = (*d_dataManager_p->getVelocityP())[i];
+  const auto &f = (*d_dataManager_p->getForceP())[i];
 
-        // reset force
-        (*this->d_dataManager_p->getForceP())[i] = util::Point3();
-      });  // end of parallel for loop
+  // modify dofs which are not marked fixed
+  for (size_t d = 0; d < dim; d++)
+    if (d_dataManager_p->getMeshP()->isNodeFree(i, d)) v[d] += fact * f[d];
+}
 
-  f.get();
+template <class T>
+void model::FDModel<T>::integrateVerlet() {
+  // step 1 and 2 : Compute v_mid and u_new
+  util::Numa::getInstance()->forLoop(
+      d_dataManager_p->getMeshP()->getNumNodes(),
+      [this](boost::uint64_t i) { this->verletKickDrift(i); });
 
   // compute forces and energy due to new displacement field (this will be
   // used in next time step)
@@ -507,7 +974,6 @@ void model::FDModel<T>::integrateVerlet() {
   d_time += d_dataManager_p->getModelDeckP()->d_dt;
 
   if (d_n < d_dataManager_p->getModelDeckP()->d_Nt) {
-    // std::cout << "force applied" << std::endl;
     // boundary condition
     d_dataManager_p->getDisplacementLoadingP()->apply(
         d_time, d_dataManager_p->getDisplacementP(),
@@ -529,45 +995,659 @@ void model::FDModel<T>::integrateVerlet() {
   computeForces();
 
   // Step 3: Compute v_new
-  f = hpx::experimental::for_loop(
-      hpx::execution::par(hpx::execution::task), 0,
-      d_dataManager_p->getMeshP()->getNumNodes(), [this](boost::uint64_t i) {
-        auto dim = this->d_dataManager_p->getMeshP()->getDimension();
-        auto fact = 0.5 * this->d_dataManager_p->getModelDeckP()->d_dt /
-                    this->d_material_p->getDensity();
+  util::Numa::getInstance()->forLoop(
+      d_dataManager_p->getMeshP()->getNumNodes(),
+      [this](boost::uint64_t i) { this->verletKick(i); });
+}
 
-        // modify dofs which are not marked fixed
-        if (this->d_dataManager_p->getMeshP()->isNodeFree(i, 0))
-          (*d_dataManager_p->getVelocityP())[i].d_x +=
-              fact * (*this->d_dataManager_p->getForceP())[i].d_x;
+template <class T>
+void model::FDModel<T>::initTiles() {
+  if (d_input_p->getMaterialDeck()->d_has_disserpation) {
+    std::cerr << "Error: Tiling does not support dissipation since the "
+                 "dissipative force depends on the velocity of neighbors.\n";
+    exit(1);
+  }
 
-        if (dim > 1)
-          if (this->d_dataManager_p->getMeshP()->isNodeFree(i, 1))
-            (*d_dataManager_p->getVelocityP())[i].d_y +=
-                fact * (*this->d_dataManager_p->getForceP())[i].d_y;
+  // wavefront needs tiles which only depend on tiles with nearby ids
+  std::cout << "FDModel: Creating spatial tiles.\n";
+  d_tiles_p = new geometry::Tiles(
+      d_dataManager_p->getModelDeckP()->d_numTiles,
+      d_dataManager_p->getMeshP()->getNodes(),
+      d_dataManager_p->getNeighborP()->getNeighborsList(),
+      d_dataManager_p->getModelDeckP()->d_timeBlock > 1 ? "slab" : "morton");
+
+  const size_t ntiles = d_tiles_p->getNumTiles();
+
+  // boundary condition nodes per tile
+  d_tileUBCNodes = std::vector<std::vector<std::pair<size_t, size_t>>>(ntiles);
+  d_tileFBCNodes = std::vector<std::vector<std::pair<size_t, size_t>>>(ntiles);
+  const auto &uNodes = d_dataManager_p->getDisplacementLoadingP()->d_bcNodes;
+  for (size_t s = 0; s < uNodes.size(); s++)
+    for (auto i : uNodes[s])
+      d_tileUBCNodes[d_tiles_p->getTile(i)].emplace_back(s, i);
+  const auto &fNodes = d_dataManager_p->getForceLoadingP()->d_bcNodes;
+  for (size_t s = 0; s < fNodes.size(); s++)
+    for (auto i : fNodes[s])
+      d_tileFBCNodes[d_tiles_p->getTile(i)].emplace_back(s, i);
+
+  // tiles holding nodes with displacement or force boundary condition
+  std::vector<uint8_t> isLoading(ntiles, 0);
+  for (const auto &nodes :
+       d_dataManager_p->getDisplacementLoadingP()->d_bcNodes)
+    for (auto i : nodes) isLoading[d_tiles_p->getTile(i)] = 1;
+  for (const auto &nodes : d_dataManager_p->getForceLoadingP()->d_bcNodes)
+    for (auto i : nodes) isLoading[d_tiles_p->getTile(i)] = 1;
+
+  d_loadingTiles.clear();
+  d_tileLoading = std::vector<uint8_t>(ntiles, 0);
+  for (size_t t = 0; t < ntiles; t++) {
+    if (isLoading[t]) d_loadingTiles.push_back(t);
+
+    for (auto s : d_tiles_p->getNeighborTiles(t))
+      if (isLoading[s]) d_tileLoading[t] = 1;
+  }
+}
 
-        if (dim > 2)
-          if (this->d_dataManager_p->getMeshP()->isNodeFree(i, 2))
-            (*d_dataManager_p->getVelocityP())[i].d_z +=
-                fact * (*this->d_dataManager_p->getForceP())[i].d_z;
-      });  // end of parallel for loop
+template <class T>
+size_t model::FDModel<T>::getTiledSteps(size_t maxSteps) const {
+  const auto *modelDeck = d_dataManager_p->getModelDeckP();
+
+  // last step of loading and steps after it are left to integrateVerlet()
+  if (d_n + 1 >= modelDeck->d_Nt) return 0;
+
+  size_t n = std::min(maxSteps, modelDeck->d_Nt - 1 - d_n);
+
+  // stop at the next output step
+  size_t dt_out = d_dataManager_p->getOutputDeckP()->d_dtOut;
+  if (dt_out > 0) n = std::min(n, dt_out - d_n % dt_out);
+
+  // stop at the step after which the next crack is added
+  double activation = d_dataManager_p->getFractureP()->getNextActivationTime();
+  double time = d_time;
+  for (size_t k = 1; k <= n; k++) {
+    time += modelDeck->d_dt;
+    if (util::compare::definitelyLessThan(activation, time)) return k;
+  }
+
+  return n;
+}
+
+template <class T>
+void model::FDModel<T>::integrateTiled(size_t nsteps) {
+  using deps_type = std::vector<hpx::shared_future<void>>;
+
+  const size_t ntiles = d_tiles_p->getNumTiles();
+  const double delta_t = d_dataManager_p->getModelDeckP()->d_dt;
+  const size_t lookahead = d_dataManager_p->getModelDeckP()->d_tileLookahead;
+
+  util::Counters::addBondEvaluations(nsteps * d_numBonds);
+
+  // time of the force computation summed over the tasks of all tiles
+  std::atomic<std::uint64_t> forceTime(0);
+
+  // futures of force computation of tiles of recent steps, the first step
+  // only depends on the current state
+  std::deque<deps_type> forces;
+  forces.emplace_back(ntiles, hpx::make_ready_future().share());
+
+  deps_type drift(ntiles);
+  double time = d_time;
+  for (size_t k = 0; k < nsteps; k++) {
+    const auto &force = forces.back();
+    time += delta_t;
+
+    // step 1 and 2 of tile overwrite the displacement read by the force
+    // computation of neighboring tiles and need the force of the tile
+    for (size_t t = 0; t < ntiles; t++) {
+      deps_type deps;
+      deps.reserve(d_tiles_p->getNeighborTiles(t).size());
+      for (auto s : d_tiles_p->getNeighborTiles(t)) deps.push_back(force[s]);
+
+      drift[t] = hpx::dataflow(
+                     hpx::launch::async,
+                     [this, t](deps_type &&) {
+                       for (auto i : this->d_tiles_p->getNodes(t))
+                         this->verletKickDrift(i);
+                     },
+                     std::move(deps))
+                     .share();
+    }
+
+    // boundary condition once the tiles holding its nodes have moved
+    auto loading = hpx::make_ready_future().share();
+    if (!d_loadingTiles.empty()) {
+      deps_type deps;
+      deps.reserve(d_loadingTiles.size());
+      for (auto t : d_loadingTiles) deps.push_back(drift[t]);
+
+      loading = hpx::dataflow(
+                    hpx::launch::async,
+                    [this, time](deps_type &&) {
+                      auto *dm = this->d_dataManager_p;
+                      dm->getDisplacementLoadingP()->apply(
+                          time, dm->getDisplacementP(), dm->getVelocityP(),
+                          dm->getMeshP());
+                      dm->getForceLoadingP()->apply(time, dm->getForceP(),
+                                                    dm->getMeshP());
+                    },
+                    std::move(deps))
+                    .share();
+    }
+
+    // step 3 of tile once the neighboring tiles have moved
+    deps_type next(ntiles);
+    for (size_t t = 0; t < ntiles; t++) {
+      deps_type deps;
+      deps.reserve(d_tiles_p->getNeighborTiles(t).size() + 1);
+      for (auto s : d_tiles_p->getNeighborTiles(t)) deps.push_back(drift[s]);
+      if (d_tileLoading[t]) deps.push_back(loading);
+
+      next[t] = hpx::dataflow(
+                    hpx::launch::async,
+                    [this, t, &forceTime](deps_type &&) {
+                      auto &f = *this->d_dataManager_p->getForceP();
+                      const auto &nodes = this->d_tiles_p->getNodes(t);
+                      std::uint64_t begin =
+                          hpx::chrono::high_resolution_clock::now();
+                      for (auto i : nodes) f[i] += this->computeForce(i).second;
+                      forceTime += hpx::chrono::high_resolution_clock::now() -
+                                   begin;
+
+                      for (auto i : nodes) this->verletKick(i);
+                    },
+                    std::move(deps))
+                    .share();
+    }
+
+    forces.push_back(std::move(next));
+
+    // limit how far tiles may run ahead of the slowest tile
+    if (forces.size() > lookahead) {
+      hpx::wait_all(forces.front());
+      forces.pop_front();
+    }
+  }
+
+  for (auto &fs : forces) hpx::wait_all(fs);
+
+  addTiledForceTime(forceTime);
+
+  for (size_t k = 0; k < nsteps; k++) {
+    d_n++;
+    d_time += delta_t;
+  }
+}
+
+template <class T>
+void model::FDModel<T>::integrateWavefront(size_t nsteps) {
+  using deps_type = std::vector<hpx::shared_future<void>>;
+
+  const size_t ntiles = d_tiles_p->getNumTiles();
+  const size_t w = d_tiles_p->getReach();
+  const double delta_t = d_dataManager_p->getModelDeckP()->d_dt;
+
+  util::Counters::addBondEvaluations(nsteps * d_numBonds);
+
+  // time of the force computation summed over the tasks of all tiles
+  std::atomic<std::uint64_t> forceTime(0);
+
+  // number of tiles in a cache block, at least 2w so that the tiles within
+  // reach of a unit are covered by its two preceding units
+  size_t block = d_dataManager_p->getModelDeckP()->d_blockNodes * ntiles /
+                 std::max(d_dataManager_p->getMeshP()->getNumNodes(),
+                          size_t(1));
+  block = std::max(block, std::max(2 * w, size_t(1)));
+
+  // times of the steps of the block
+  std::vector<double> times(nsteps);
+  double time = d_time;
+  for (size_t k = 0; k < nsteps; k++) {
+    time += delta_t;
+    times[k] = time;
+  }
+
+  // blocks needed to cover all tiles in the most shifted phase
+  const size_t nphases = 2 * nsteps;
+  const size_t nblocks = (ntiles + (nphases - 1) * w + block - 1) / block;
+
+  // phase of a tile
+  auto phase = [this, &times, &forceTime](size_t t, size_t q) {
+    auto *dm = this->d_dataManager_p;
+    const auto &nodes = this->d_tiles_p->getNodes(t);
+    if (q % 2 == 0) {
+      // step 1 and 2 followed by boundary condition of the tile
+      for (auto i : nodes) this->verletKickDrift(i);
+
+      double time = times[q / 2];
+      if (!this->d_tileUBCNodes[t].empty())
+        dm->getDisplacementLoadingP()->apply(
+            time, dm->getDisplacementP(), dm->getVelocityP(), dm->getMeshP(),
+            this->d_tileUBCNodes[t]);
+      if (!this->d_tileFBCNodes[t].empty())
+        dm->getForceLoadingP()->apply(time, dm->getForceP(), dm->getMeshP(),
+                                      this->d_tileFBCNodes[t]);
+    } else {
+      // force and step 3
+      auto &f = *dm->getForceP();
+      std::uint64_t begin = hpx::chrono::high_resolution_clock::now();
+      for (auto i : nodes) f[i] += this->computeForce(i).second;
+      forceTime += hpx::chrono::high_resolution_clock::now() - begin;
+
+      for (auto i : nodes) this->verletKick(i);
+    }
+  };
+
+  // unit (b, q) depends on units (b, q - 1) and (b - 1, q - 1)
+  deps_type prev(nblocks, hpx::make_ready_future().share());
+  deps_type next(nblocks);
+  for (size_t q = 0; q < nphases; q++) {
+    for (size_t b = 0; b < nblocks; b++) {
+      // tiles of unit, shifted back by q w
+      const size_t shift = q * w;
+      size_t begin = b * block > shift ? b * block - shift : 0;
+      size_t end = (b + 1) * block > shift ? (b + 1) * block - shift : 0;
+      end = std::min(end, ntiles);
+
+      deps_type deps;
+      deps.push_back(prev[b]);
+      if (b > 0) deps.push_back(prev[b - 1]);
+
+      next[b] = hpx::dataflow(
+                    hpx::launch::async,
+                    [phase, begin, end, q](deps_type &&) {
+                      if (begin >= end) return;
+
+                      hpx::experimental::for_loop(
+                          hpx::execution::par, begin, end,
+                          [&phase, q](boost::uint64_t t) { phase(t, q); });
+                    },
+                    std::move(deps))
+                    .share();
+    }
+
+    std::swap(prev, next);
+  }
+
+  hpx::wait_all(prev);
+
+  addTiledForceTime(forceTime);
+
+  for (size_t k = 0; k < nsteps; k++) {
+    d_n++;
+    d_time += delta_t;
+  }
+}
+
+template <class T>
+void model::FDModel<T>::addTiledForceTime(std::uint64_t ns) {
+  // with all threads busy, the force computations of tiles overlap on all
+  // threads, like the parallel loop of computeForces()
+  util::Counters::addTime(util::Phase::Force,
+                          ns / std::max(hpx::get_os_thread_count(),
+                                        std::size_t(1)));
+}
+
+template <class T>
+void model::FDModel<T>::integrateMultirate() {
+  auto *mesh = d_dataManager_p->getMeshP();
+  auto *modelDeck = d_dataManager_p->getModelDeckP();
+  auto &u = *d_dataManager_p->getDisplacementP();
+  auto &v = *d_dataManager_p->getVelocityP();
+  auto &force = *d_dataManager_p->getForceP();
+  const size_t nnodes = mesh->getNumNodes();
+  const size_t dim = mesh->getDimension();
+  const size_t finest = d_finestLevel;
+  const size_t num_sub = size_t(1) << finest;
+  const double delta = modelDeck->d_dt / double(num_sub);
+
+  // same loading rule as the single rate schemes
+  bool apply_load = d_n + 1 < modelDeck->d_Nt;
+
+  for (size_t s = 0; s < num_sub; s++) {
+    // step 1 and 2: kick nodes starting their step and drift all nodes
+    auto f = hpx::experimental::for_loop(
+        hpx::execution::par(hpx::execution::task), 0, nnodes,
+        [this, &u, &v, &force, mesh, dim, finest, delta,
+         s](boost::uint64_t i) {
+          auto stride = size_t(1) << (finest - this->d_level[i]);
+          auto fact = 0.5 * double(stride) * delta / this->getDensity(i);
+          bool start = s % stride == 0;
+
+          for (size_t d = 0; d < dim; d++) {
+            if (!mesh->isNodeFree(i, d)) continue;
+
+            if (start) v[i][d] += fact * force[i][d];
+            u[i][d] += delta * v[i][d];
+          }
+        });
+    f.get();
+
+    auto time = d_time + double(s + 1) * delta;
+    if (apply_load) {
+      d_dataManager_p->getDisplacementLoadingP()->apply(time, &u, &v, mesh);
+
+      f = hpx::experimental::for_loop(
+          hpx::execution::par(hpx::execution::task), 0, nnodes,
+          [this](boost::uint64_t i) { this->d_extForce[i] = util::Point3(); });
+      f.get();
+      d_dataManager_p->getForceLoadingP()->apply(time, &d_extForce, mesh);
+    }
+
+    // step 3: compute forces and kick nodes ending their step
+    f = hpx::experimental::for_loop(
+        hpx::execution::par(hpx::execution::task), 0, nnodes,
+        [this, &v, &force, mesh, dim, finest, delta, s,
+         apply_load](boost::uint64_t i) {
+          auto stride = size_t(1) << (finest - this->d_level[i]);
+          if ((s + 1) % stride != 0) return;
+
+          force[i] = this->computeForce(i).second;
+          if (apply_load) force[i] += this->d_extForce[i];
+
+          auto fact = 0.5 * double(stride) * delta / this->getDensity(i);
+          for (size_t d = 0; d < dim; d++)
+            if (mesh->isNodeFree(i, d)) v[i][d] += fact * force[i][d];
+        });
+    f.get();
+  }  // loop over substeps
+
+  d_n++;
+  d_time += modelDeck->d_dt;
+
+  if (d_n == modelDeck->d_Nt) {
+    auto f = hpx::experimental::for_loop(
+        hpx::execution::par(hpx::execution::task), 0, nnodes,
+        [&u, &v, &force](boost::uint64_t i) {
+          u[i] = util::Point3();
+          v[i] = util::Point3();
+          force[i] = util::Point3();
+        });
+    f.get();
+
+    // internal forces
+    computeForces();
+  }
+}
+
+template <class T>
+void model::FDModel<T>::integrateDR() {
+  auto *mesh = d_dataManager_p->getMeshP();
+  auto *modelDeck = d_dataManager_p->getModelDeckP();
+  auto &u = *d_dataManager_p->getDisplacementP();
+  auto &v = *d_dataManager_p->getVelocityP();
+  auto &force = *d_dataManager_p->getForceP();
+  const size_t nnodes = mesh->getNumNodes();
+  const size_t dim = mesh->getDimension();
+
+  if (d_drMass.size() != nnodes) initDRMass();
+
+  // advance the load
+  d_n++;
+  d_time += modelDeck->d_dt;
+
+  d_dataManager_p->getDisplacementLoadingP()->apply(d_time, &u, &v, mesh);
+
+  double res0 = computeDRResidual();
+  double res = res0;
+  double c = 0.;
+  size_t k = 0;
+
+  for (k = 0; k < modelDeck->d_drMaxIter; k++) {
+    if (res <= modelDeck->d_drTol * res0) break;
+
+    // update velocity and displacement of free dofs
+    auto f = hpx::experimental::for_loop(
+        hpx::execution::par(hpx::execution::task), 0, nnodes,
+        [this, &u, &v, &force, mesh, dim, c, k](boost::uint64_t i) {
+          auto m = this->d_drMass[i];
+          for (size_t d = 0; d < dim; d++) {
+            if (!mesh->isNodeFree(i, d)) continue;
+
+            if (k == 0)
+              v[i][d] = 0.5 * force[i][d] / m;
+            else
+              v[i][d] = ((2. - c) * v[i][d] + 2. * force[i][d] / m) / (2. + c);
+
+            u[i][d] += v[i][d];
+          }
 
+          this->d_drForceOld[i] = force[i];
+        });
+    f.get();
+
+    res = computeDRResidual();
+
+    // damping coefficient from the Rayleigh quotient of the local stiffness
+    f = hpx::experimental::for_loop(
+        hpx::execution::par(hpx::execution::task), 0, nnodes,
+        [this, &u, &v, &force, mesh, dim](boost::uint64_t i) {
+          double a = 0.;
+          double b = 0.;
+          for (size_t d = 0; d < dim; d++) {
+            if (!mesh->isNodeFree(i, d)) continue;
+
+            b += u[i][d] * u[i][d];
+            if (std::abs(v[i][d]) > 0.)
+              a -= u[i][d] * u[i][d] *
+                   (force[i][d] - this->d_drForceOld[i][d]) /
+                   (this->d_drMass[i] * v[i][d]);
+          }
+
+          this->d_drNum[i] = a;
+          this->d_drDen[i] = b;
+        });
+    f.get();
+
+    auto a = util::methods::add(d_drNum);
+    auto b = util::methods::add(d_drDen);
+    c = (a > 0. and b > 0.) ? 2. * std::sqrt(a / b) : 0.;
+  }
+
+  if (res > modelDeck->d_drTol * res0)
+    std::cout << "Warning: Dynamic relaxation of load step " << d_n
+              << " did not converge in " << k << " iterations. Relative "
+              << "residual = " << res / res0 << ".\n";
+  else
+    std::cout << "FDModel: Load step " << d_n << " relaxed in " << k
+              << " iterations.\n";
+}
+
+template <class T>
+void model::FDModel<T>::initDRMass() {
+  const size_t nnodes = d_dataManager_p->getMeshP()->getNumNodes();
+  double factor = 0.25 * d_dataManager_p->getModelDeckP()->d_drMassFactor;
+
+  d_drMass.resize(nnodes);
+  d_drForceOld.resize(nnodes);
+  d_drNum.resize(nnodes);
+  d_drDen.resize(nnodes);
+
+  auto f = hpx::experimental::for_loop(
+      hpx::execution::par(hpx::execution::task), 0, nnodes,
+      [this, factor](boost::uint64_t i) {
+        double k = 0.;
+        const auto &i_neighs =
+            this->d_dataManager_p->getNeighborP()->getNeighbors(i);
+        for (size_t j = 0; j < i_neighs.size(); j++)
+          k += std::abs(this->d_material_p->getBondStiffness(i, j));
+
+        this->d_drMass[i] = factor * k;
+      });
   f.get();
+
+  // nodes without intact bonds get the largest mass
+  double max_mass = util::methods::max(d_drMass);
+  if (!(max_mass > 0.)) {
+    std::cerr << "Error: Dynamic relaxation requires the bond stiffness of "
+                 "the material.\n";
+    exit(1);
+  }
+
+  for (auto &m : d_drMass)
+    if (!(m > 0.)) m = max_mass;
+}
+
+template <class T>
+double model::FDModel<T>::computeDRResidual() {
+  auto *mesh = d_dataManager_p->getMeshP();
+  auto &force = *d_dataManager_p->getForceP();
+
+  auto f = hpx::experimental::for_loop(
+      hpx::execution::par(hpx::execution::task), 0, mesh->getNumNodes(),
+      [&force](boost::uint64_t i) { force[i] = util::Point3(); });
+  f.get();
+
+  d_dataManager_p->getForceLoadingP()->apply(d_time, &force, mesh);
+  computeForces();
+
+  f = hpx::experimental::for_loop(
+      hpx::execution::par(hpx::execution::task), 0, mesh->getNumNodes(),
+      [this, &force, mesh](boost::uint64_t i) {
+        double r = 0.;
+        for (size_t d = 0; d < mesh->getDimension(); d++)
+          if (mesh->isNodeFree(i, d)) r += force[i][d] * force[i][d];
+        this->d_drNum[i] = r;
+      });
+  f.get();
+
+  return std::sqrt(util::methods::add(d_drNum));
 }
 
 template <class T>
 void model::FDModel<T>::computeForces() {
+  util::ScopedTimer timer(util::Phase::Force);
+  util::Counters::addBondEvaluations(d_numBonds);
+
   const auto &nodes = d_dataManager_p->getMeshP()->getNodes();
 
-  auto f =
-      hpx::experimental::for_loop(hpx::execution::par(hpx::execution::task), 0,
-                                  d_dataManager_p->getMeshP()->getNumNodes(),
-                                  [this](boost::uint64_t i) {
-                                    (*this->d_dataManager_p->getForceP())[i] +=
-                                        this->computeForce(i).second;
-                                  }  // loop over nodes
-      );                             // end of parallel for loop
-  f.get();
+  if (!d_ghostExchange) {
+    forEachNode([this](boost::uint64_t i) {
+      (*this->d_dataManager_p->getForceP())[i] += this->computeForce(i).second;
+    });
+    return;
+  }
+
+  // overlap exchange of ghost displacements with interior nodes
+  auto ghosts = d_ghostExchange();
+  forEachNode([this](boost::uint64_t i) {
+    if (!this->d_ghostBoundary[i])
+      (*this->d_dataManager_p->getForceP())[i] += this->computeForce(i).second;
+  });
+
+  ghosts.get();
+  forEachNode([this](boost::uint64_t i) {
+    if (this->d_ghostBoundary[i])
+      (*this->d_dataManager_p->getForceP())[i] += this->computeForce(i).second;
+  });
+}
+
+template <class T>
+template <class F>
+void model::FDModel<T>::forEachNode(F &&f) {
+  if (d_partitioner_p != nullptr)
+    d_partitioner_p->forLoop(f);
+  else
+    util::Numa::getInstance()->forLoop(
+        d_dataManager_p->getMeshP()->getNumNodes(), f);
+}
+
+template <class T>
+template <class F>
+void model::FDModel<T>::forEachBond(const size_t &i, F &&f) {
+  if (d_cellList_p == nullptr) {
+    const auto *fracture = d_dataManager_p->getFractureP();
+    const auto &i_neighs = d_dataManager_p->getNeighborP()->getNeighbors(i);
+    for (size_t j = 0; j < i_neighs.size(); j++) {
+      auto fe_pair = d_material_p->getBondEF(i, j);
+      f(i_neighs[j], fe_pair, fracture->getBondState(i, j));
+    }
+    return;
+  }
+
+  d_cellList_p->forEachNeighbor(i, [&](size_t j_id) {
+    bool fs = d_sparseFracture_p->getBondState(i, j_id);
+    const bool fs_old = fs;
+    auto fe_pair = d_material_p->getBondEF(i, j_id, fs);
+    if (fs != fs_old) d_sparseFracture_p->setBondState(i, j_id, fs);
+
+    f(j_id, fe_pair, fs);
+  });
+}
+
+template <class T>
+void model::FDModel<T>::initWorkPartition() {
+  d_partitioner_p = new util::WorkPartitioner(
+      d_dataManager_p->getModelDeckP()->d_chunksPerThread);
+  updateWorkPartition();
+
+  // the force of a node only depends on the current displacement, thus the
+  // calibration does not change the state
+  if (d_partitioner_p->getChunksPerThread() == 0) {
+    std::cout << "FDModel: Calibrating chunk size of node loops.\n";
+    d_partitioner_p->calibrate(
+        [this](boost::uint64_t i) { this->computeForce(i); });
+  }
+
+  std::cout << "FDModel: Chunks per thread = "
+            << d_partitioner_p->getChunksPerThread()
+            << ", number of chunks = " << d_partitioner_p->getNumChunks()
+            << ", imbalance = " << d_partitioner_p->getImbalance() << ".\n";
+}
+
+template <class T>
+void model::FDModel<T>::updateWorkPartition() {
+  const size_t nnodes = d_dataManager_p->getMeshP()->getNumNodes();
+  const auto *fracture = d_dataManager_p->getFractureP();
+
+  // cost of a node relative to an intact bond, broken bonds only compute
+  // the contact force
+  const double node_cost = 2.;
+  const double broken_cost = 0.5;
+
+  std::vector<double> cost(nnodes);
+  util::Numa::getInstance()->forLoop(nnodes, [&](boost::uint64_t i) {
+    const size_t nbonds =
+        this->d_dataManager_p->getNeighborP()->getNeighbors(i).size();
+    double c = node_cost;
+    for (size_t j = 0; j < nbonds; j++)
+      c += fracture->getBondState(i, j) ? broken_cost : 1.;
+    cost[i] = c;
+  });
+
+  d_partitioner_p->setCosts(cost);
+}
+
+template <class T>
+size_t model::FDModel<T>::countBrokenBonds() {
+  const size_t nnodes = d_dataManager_p->getMeshP()->getNumNodes();
+  const auto *fracture = d_dataManager_p->getFractureP();
+
+  if (d_sparseFracture_p != nullptr) {
+    size_t n = 0;
+    for (size_t i = 0; i < nnodes; i++)
+      n += d_sparseFracture_p->getNumBrokenBonds(i);
+    return n;
+  }
+
+  std::vector<size_t> broken(nnodes, 0);
+  util::Numa::getInstance()->forLoop(nnodes, [&](boost::uint64_t i) {
+    const size_t nbonds =
+        this->d_dataManager_p->getNeighborP()->getNeighbors(i).size();
+    for (size_t j = 0; j < nbonds; j++)
+      if (fracture->getBondState(i, j)) broken[i]++;
+  });
+
+  return std::accumulate(broken.begin(), broken.end(), size_t(0));
+}
+
+template <class T>
+bool model::FDModel<T>::populateData(inp::PolicyTag tag) const {
+  return (d_dataMask & inp::getTagBit(tag)) != 0;
+}
+
+template <class T>
+bool model::FDModel<T>::isTagInOutput(inp::OutputTag tag) const {
+  return (d_outMask & inp::getTagBit(tag)) != 0;
 }
 
 template <class T>
@@ -577,20 +1657,18 @@ std::pair<double, util::Point3> model::FDModel<T>::computeForce(
   auto force_i = util::Point3();
   double energy_i = 0.;
 
-  if (d_dataManager_p->getOutputDeckP()->isTagInOutput("Reaction_Force") or
-      d_dataManager_p->getOutputDeckP()->isTagInOutput(
-          "Total_Reaction_Force")) {
+  const bool reaction = isTagInOutput(inp::OutputTag::Reaction_Force) or
+                        isTagInOutput(inp::OutputTag::Total_Reaction_Force);
+  if (reaction) {
     (*d_dataManager_p->getReactionForceP())[i] = util::Point3();
     (*d_dataManager_p->getTotalReactionForceP())[i] = 0.;
   }
 
-  // inner loop over neighbors
-  const auto &i_neighs = this->d_dataManager_p->getNeighborP()->getNeighbors(i);
-  for (size_t j = 0; j < i_neighs.size(); j++) {
-    auto j_id = i_neighs[j];
-
-    auto fe_pair = d_material_p->getBondEF(i, j);
-
+  // inner loop over neighbors (j is the local id of bond, dissipation is
+  // only supported with neighbor list)
+  size_t j = 0;
+  forEachBond(i, [&](size_t j_id,
+                     const std::pair<util::Point3, double> &fe_pair, bool) {
     force_i += fe_pair.first;
     energy_i += fe_pair.second;
 
@@ -598,17 +1676,15 @@ std::pair<double, util::Point3> model::FDModel<T>::computeForce(
       force_i += d_material_p->getDissipation(i, j);
 
     // Todo: Add reaction force computation
-    if (is_reaction_force(i, j_id) and
-        (d_dataManager_p->getOutputDeckP()->isTagInOutput("Reaction_Force") or
-         d_dataManager_p->getOutputDeckP()->isTagInOutput(
-             "Total_Reaction_Force")))
+    if (reaction and is_reaction_force(i, j_id))
       (*d_dataManager_p->getReactionForceP())[i] +=
           (this->d_dataManager_p->getMeshP()->getNodalVolume(i) *
            fe_pair.first);
 
-  }  // loop over neighboring nodes
+    j++;
+  });  // loop over neighboring nodes
 
-  if (d_dataManager_p->getOutputDeckP()->isTagInOutput("Total_Reaction_Force"))
+  if (isTagInOutput(inp::OutputTag::Total_Reaction_Force))
     (*d_dataManager_p->getTotalReactionForceP())[i] =
         (*d_dataManager_p->getReactionForceP())[i].length();
 
@@ -685,10 +1761,11 @@ void model::FDModel<T>::computeDampingForces() {
 template <class T>
 void model::FDModel<T>::computePostProcFields() {
   std::cout << "Postprocessing\n";
+  util::ScopedTimer timer(util::Phase::PostProcessing);
 
   // if work done is to be computed, get the external forces
   std::vector<util::Point3> f_ext;
-  if (d_policy_p->populateData("Model_d_w")) {
+  if (populateData(inp::PolicyTag::Model_d_w)) {
     f_ext = std::vector<util::Point3>(
         d_dataManager_p->getMeshP()->getNumNodes(), util::Point3());
     d_dataManager_p->getForceLoadingP()->apply(d_time, &f_ext,
@@ -697,12 +1774,10 @@ void model::FDModel<T>::computePostProcFields() {
 
   // local data for kinetic energy
   std::vector<float> vec_ke;
-  if (this->d_policy_p->populateData("Model_d_e"))
+  if (this->populateData(inp::PolicyTag::Model_d_e))
     vec_ke = (*d_dataManager_p->getKineticEnergyP());
 
-  auto f = hpx::experimental::for_loop(
-      hpx::execution::par(hpx::execution::task), 0,
-      d_dataManager_p->getMeshP()->getNumNodes(),
+  forEachNode(
       [this, &f_ext, &vec_ke](boost::uint64_t i) {
         // local variable
         double energy_i = 0.0;
@@ -725,14 +1800,9 @@ void model::FDModel<T>::computePostProcFields() {
         auto voli = this->d_dataManager_p->getMeshP()->getNodalVolume(i);
 
         // inner loop over neighbors
-        const auto &i_neighs =
-            this->d_dataManager_p->getNeighborP()->getNeighbors(i);
-        for (size_t j = 0; j < i_neighs.size(); j++) {
-          auto j_id = i_neighs[j];
-
-          auto fe_pair = this->d_material_p->getBondEF(i, j);
-          auto fs = this->d_dataManager_p->getFractureP()->getBondState(i, j);
-
+        this->forEachBond(i, [&](size_t j_id,
+                                 const std::pair<util::Point3, double> &fe_pair,
+                                 bool fs) {
           // energy
           energy_i += fe_pair.second;
 
@@ -755,37 +1825,37 @@ void model::FDModel<T>::computePostProcFields() {
           if (util::compare::definitelyGreaterThan(rji, 1.0E-12))
             sr = std::abs(Sji) / this->d_material_p->getSc(rji);
           if (util::compare::definitelyLessThan(z, sr)) z = sr;
-        }  // loop over neighboring nodes
+        });  // loop over neighboring nodes
 
         // compute hydrostatic energy
         //        if (this->d_material_p->isStateActive())
         //          hydro_energy_i =
         //          this->d_material_p->getStateEnergy(this->d_hS[i]);
 
-        if (this->d_policy_p->populateData("Model_d_e"))
+        if (this->populateData(inp::PolicyTag::Model_d_e))
           (*d_dataManager_p->getStrainEnergyP())[i] =
               (energy_i + hydro_energy_i) * voli;
 
-        if (this->d_policy_p->populateData("Model_d_w"))
+        if (this->populateData(inp::PolicyTag::Model_d_w))
           (*d_dataManager_p->getWorkDoneP())[i] = ui.dot(f_ext[i]);
 
-        if (this->d_policy_p->populateData("Model_d_eFB") &&
+        if (this->populateData(inp::PolicyTag::Model_d_eFB) &&
             util::compare::definitelyGreaterThan(z, 1.0 - 1.0E-10))
           (*d_dataManager_p->getBBFractureEnergyP())[i] = energy_i * voli;
 
-        if (this->d_policy_p->populateData("Model_d_eF") &&
+        if (this->populateData(inp::PolicyTag::Model_d_eF) &&
             util::compare::definitelyGreaterThan(z, 1.0 - 1.0E-10))
           (*d_dataManager_p->getFractureEnergyP())[i] =
               (energy_i + hydro_energy_i) * voli;
 
-        if (this->d_policy_p->populateData("Model_d_phi"))
+        if (this->populateData(inp::PolicyTag::Model_d_phi))
           (*d_dataManager_p->getPhiP())[i] = 1. - a / b;
 
-        if (this->d_policy_p->populateData("Model_d_Z"))
+        if (this->populateData(inp::PolicyTag::Model_d_Z))
           (*d_dataManager_p->getDamageFunctionP())[i] = z;
 
         // compute kinetic energy
-        if (this->d_policy_p->populateData("Model_d_e"))
+        if (this->populateData(inp::PolicyTag::Model_d_e))
           (*d_dataManager_p->getKineticEnergyP())[i] =
               0.5 * this->d_material_p->getDensity() *
               (*d_dataManager_p->getVelocityP())[i].dot(
@@ -795,19 +1865,17 @@ void model::FDModel<T>::computePostProcFields() {
 
   );  // end of parallel for loop
 
-  f.get();
-
   // add energies to get total energy
-  if (this->d_policy_p->populateData("Model_d_e"))
+  if (this->populateData(inp::PolicyTag::Model_d_e))
     d_te = util::methods::add((*d_dataManager_p->getStrainEnergyP()));
-  if (this->d_policy_p->populateData("Model_d_w"))
+  if (this->populateData(inp::PolicyTag::Model_d_w))
     d_tw = util::methods::add((*d_dataManager_p->getWorkDoneP()));
-  if (this->d_policy_p->populateData("Model_d_eF"))
+  if (this->populateData(inp::PolicyTag::Model_d_eF))
     d_teF = util::methods::add((*d_dataManager_p->getFractureEnergyP()));
-  if (this->d_policy_p->populateData("Model_d_eFB"))
+  if (this->populateData(inp::PolicyTag::Model_d_eFB))
     d_teFB = util::methods::add((*d_dataManager_p->getBBFractureEnergyP()));
 
-  if (this->d_policy_p->populateData("Model_d_e"))
+  if (this->populateData(inp::PolicyTag::Model_d_e))
     d_tk = util::methods::add((*d_dataManager_p->getKineticEnergyP()));
 }
 
@@ -835,11 +1903,10 @@ void model::FDModel<T>::checkOutputCriteria() {
     // change from large interval to small interval should be done only once
     // to do this, we check below flag which will be set to true in first
     // change to small from small interval
-    static bool changed_to_small = false;
     bool changed_to_small_at_current = false;
     if (d_dataManager_p->getOutputDeckP()->d_dtOut >
             d_dataManager_p->getOutputDeckP()->d_dtOutCriteria &&
-        !changed_to_small) {
+        !d_changedToSmall) {
       // get maximum from the damage data
       auto max = util::methods::max((*d_dataManager_p->getDamageFunctionP()));
 
@@ -861,7 +1928,7 @@ void model::FDModel<T>::checkOutputCriteria() {
               << "\n";
         fdump.close();
 
-        changed_to_small = true;
+        d_changedToSmall = true;
         changed_to_small_at_current = true;
       }
     }  // if current dt out is larger
@@ -875,8 +1942,7 @@ void model::FDModel<T>::checkOutputCriteria() {
     // change from small to large interval should be done only once
     // to do this, we check below flag which will be set to true in first
     // change to large from small interval
-    static bool changed_back_to_large = false;
-    if (!changed_to_small_at_current && !changed_back_to_large &&
+    if (!changed_to_small_at_current && !d_changedBackToLarge &&
         d_dataManager_p->getOutputDeckP()->d_outCriteria == "max_Z_stop" &&
         d_dataManager_p->getOutputDeckP()->d_dtOut <
             d_dataManager_p->getOutputDeckP()->d_dtOutOld) {
@@ -940,7 +2006,7 @@ void model::FDModel<T>::checkOutputCriteria() {
               << "\n";
         fdump.close();
 
-        changed_back_to_large = true;
+        d_changedBackToLarge = true;
 
         d_stop = true;
       }
@@ -12,6 +12,9 @@
 #include <model/model.h>
 #include <geometry/dampingGeom.h>
 #include <hpx/config.hpp>
+#include <hpx/include/lcos.hpp>
+#include <cstdint>
+#include <functional>
 #include <vector>
 
 // forward declaration of class
@@ -26,14 +29,23 @@ class Fracture;
 class InteriorFlags;
 class Neighbor;
 class DampingGeom;
+class Tiles;
+class CellList;
+class SparseFracture;
 } // namespace geometry
 
+namespace util {
+class WorkPartitioner;
+} // namespace util
+
 namespace inp {
 struct ModelDeck;
 struct RestartDeck;
 struct OutputDeck;
 class Input;
 class Policy;
+enum class OutputTag : std::uint8_t;
+enum class PolicyTag : std::uint8_t;
 } // namespace inp
 
 namespace loading {
@@ -88,8 +100,122 @@ public:
    */
   explicit FDModel(inp::Input *deck);
 
+  /*!
+   * @brief Constructor for a model embedded in another code or sharing the
+   * mesh and neighbor list
+   *
+   * The model is initialized but not integrated in time, see simulate() and
+   * step(). Mesh and neighbor list are created from the deck if null,
+   * otherwise they are not deleted by the model. If fracture is not null,
+   * the initial state of bonds is copied from it instead of being
+   * recomputed.
+   *
+   * @param deck The input deck
+   * @param mesh Mesh
+   * @param neighbor Neighbor list
+   * @param fracture Fracture object with the initial state of bonds
+   */
+  FDModel(inp::Input *deck, fe::Mesh *mesh, geometry::Neighbor *neighbor,
+          const geometry::Fracture *fracture);
+
   ~FDModel();
 
+  /*!
+   * @brief Integrates in time a model created with shared mesh and
+   * neighbor list
+   */
+  void simulate();
+
+  /**
+   * @name Interface for coupled codes
+   *
+   * A coupled code creates the model with the constructor which does not
+   * integrate, exchanges data through the references below, and advances the
+   * model with step(). The references stay valid during the lifetime of the
+   * model. Prescribed displacement and force of the regions
+   * `Displacement_from_pum` and `Force_from_pum` are read from
+   * fe::Mesh::getPrescribedValues() whenever the loading is applied.
+   */
+  /**@{*/
+
+  /*!
+   * @brief Advances the model by the given number of time steps
+   *
+   * Initial condition and loading are applied and the output of the initial
+   * state is written in the first call.
+   *
+   * @param n Number of time steps
+   */
+  void step(size_t n = 1);
+
+  /*!
+   * @brief Returns the displacement of nodes
+   * @return Vector Displacement
+   */
+  std::vector<util::Point3> &getDisplacement();
+
+  /*!
+   * @brief Returns the velocity of nodes
+   * @return Vector Velocity
+   */
+  std::vector<util::Point3> &getVelocity();
+
+  /*!
+   * @brief Returns the force density, internal and external, of nodes
+   * @return Vector Force density
+   */
+  std::vector<util::Point3> &getForce();
+
+  /*!
+   * @brief Returns the mesh, which holds the prescribed values of coupling
+   * @return Pointer Mesh
+   */
+  fe::Mesh *getMesh();
+
+  /*!
+   * @brief Returns the current time step
+   * @return n Current time step
+   */
+  size_t getStep() const { return d_n; }
+
+  /*!
+   * @brief Returns the current time
+   * @return time Current time
+   */
+  double getTime() const { return d_time; }
+
+  /*!
+   * @brief Returns the number of broken bonds
+   * @return N Number of broken bonds
+   */
+  size_t getNumBrokenBonds() { return countBrokenBonds(); }
+
+  /*!
+   * @brief Sets the exchange of ghost displacements of a distributed model
+   *
+   * Before each force computation, the exchange is started and the force of
+   * nodes without ghost neighbors is computed while the exchange is in
+   * flight. The force of the remaining nodes is computed once the exchange
+   * is complete.
+   *
+   * @param exchange Function starting the exchange
+   * @param boundary Flag per node if the node has a ghost neighbor
+   */
+  void setGhostExchange(std::function<hpx::future<void>()> exchange,
+                        std::vector<uint8_t> boundary);
+
+  /*!
+   * @brief Returns the wall time of one force computation
+   *
+   * Used by the dry run to calibrate the time per step. The force of nodes
+   * is modified.
+   *
+   * @param repeat Number of force computations to average over
+   * @return Time Time in seconds
+   */
+  double timeForces(size_t repeat = 3);
+
+  /** @}*/
 
 private:
   /*!
@@ -109,6 +235,74 @@ private:
    */
   void computeForces();
 
+  /*!
+   * @brief Parallel loop over nodes
+   *
+   * Uses chunks of equal bond work if work partitioning is enabled, else
+   * the NUMA domains owning the nodes.
+   *
+   * @param f Function called for every node id
+   */
+  template <class F> void forEachNode(F &&f);
+
+  /*!
+   * @brief Loop over bonds of node
+   *
+   * Calls f(j_id, fe, fs) for every bond of node i, where j_id is the global
+   * id of the neighboring node, fe the pair of force and energy from the
+   * material, and fs the fracture state after the force computation. The
+   * bonds are taken from the neighbor list, or enumerated from the cell list
+   * in the low-memory mode of inp::Policy.
+   *
+   * @param i Id of node
+   * @param f Function called for every bond
+   */
+  template <class F> void forEachBond(const size_t &i, F &&f);
+
+  /*!
+   * @brief Creates the work partitioner and calibrates its chunk size
+   */
+  void initWorkPartition();
+
+  /*!
+   * @brief Updates the cost of nodes from the fracture state of bonds
+   */
+  void updateWorkPartition();
+
+  /*!
+   * @brief Counts the broken bonds for the performance counters
+   * @return N Number of broken bonds
+   */
+  size_t countBrokenBonds();
+
+  /*!
+   * @brief Reports the broken bonds of this model to the performance
+   * counters
+   * @param n Number of broken bonds
+   */
+  void reportBrokenBonds(size_t n);
+
+  /*!
+   * @brief Reports the memory of neighbor lists and bond states of this
+   * model to the performance counters
+   * @param n Number of bytes
+   */
+  void reportBondBytes(size_t n);
+
+  /*!
+   * @brief Returns true if the data of policy tag is populated
+   * @param tag Policy tag
+   * @return True If data is populated
+   */
+  bool populateData(inp::PolicyTag tag) const;
+
+  /*!
+   * @brief Returns true if the output tag is in the output deck
+   * @param tag Output tag
+   * @return True If tag is in output
+   */
+  bool isTagInOutput(inp::OutputTag tag) const;
+
   /*!
    * @brief Computes peridynamic force on node
    * @param i Id of node
@@ -149,6 +343,33 @@ private:
    */
   void init();
 
+  /*!
+   * @brief Estimates the stable time step of the explicit schemes
+   *
+   * The critical time step of node i is
+   * \f[ \Delta t_i = \sqrt{\frac{2 \rho}{\sum_j k_{ij}}}, \f]
+   * where \f$ k_{ij} \f$ is the bond stiffness, see Silling and Askari
+   * (2005). If a maximum added mass is given, the density of nodes with
+   * \f$ s \Delta t_i < \Delta t \f$, with s the safety factor, is scaled up
+   * (by at most the maximum added mass) so that they no longer limit the
+   * time step. The time step of the model deck is replaced by the estimate
+   * if requested, otherwise a warning is issued if it is not stable.
+   *
+   * For the multirate scheme the time step of the model deck is the time
+   * step of level 0, the coarsest level, and nodes are assigned the smallest
+   * level l with \f$ \Delta t / 2^l \le s \Delta t_i \f$.
+   */
+  void initTimeStep();
+
+  /*!
+   * @brief Returns the density of node i including the added mass
+   * @param i Id of node
+   * @return density Density
+   */
+  double getDensity(const size_t &i) const {
+    return d_density.empty() ? d_material_p->getDensity() : d_density[i];
+  }
+
   /** @}*/
 
   /**
@@ -161,6 +382,26 @@ private:
    */
   void integrate();
 
+  /*!
+   * @brief Applies initial condition and loading, computes forces, and
+   * writes output of the initial state
+   */
+  void initIntegrate();
+
+  /*!
+   * @brief Performs time steps followed by output and crack application
+   *
+   * Without tiling, exactly one time step is performed. With tiling, up to
+   * maxSteps steps are performed by integrateTiled() as long as no output,
+   * crack insertion, or end of loading is due in between. With temporal
+   * blocking, at most ModelDeck::d_timeBlock steps are performed by
+   * integrateWavefront().
+   *
+   * @param maxSteps Maximum number of time steps
+   * @return bool False if the simulation is to be stopped
+   */
+  bool integrateStep(size_t maxSteps = 1);
+
   /*!
    * @brief Perform time integration using central-difference scheme
    *
@@ -186,6 +427,148 @@ private:
    */
   void integrateVerlet();
 
+  /*!
+   * @brief Performs step 1 and 2 of velocity verlet for a node and resets
+   * its force
+   * @param i Id of node
+   */
+  void verletKickDrift(const size_t &i);
+
+  /*!
+   * @brief Performs step 3 of velocity verlet for a node
+   * @param i Id of node
+   */
+  void verletKick(const size_t &i);
+
+  /*!
+   * @brief Creates spatial tiles and finds the tiles depending on loading
+   */
+  void initTiles();
+
+  /*!
+   * @brief Returns the number of time steps which can be performed by
+   * integrateTiled()
+   *
+   * Tiled steps end at the next output step and at the step after which a
+   * crack is added. The last step of loading and the steps after it are
+   * performed by integrateVerlet().
+   *
+   * @param maxSteps Maximum number of time steps
+   * @return n Number of time steps (zero if next step can not be tiled)
+   */
+  size_t getTiledSteps(size_t maxSteps) const;
+
+  /*!
+   * @brief Performs time steps of velocity verlet on spatial tiles without
+   * global barriers
+   *
+   * Each step of a tile consists of two tasks chained by hpx::dataflow:
+   *
+   * 1. step 1 and 2 of the tile start once the tile and its neighboring
+   * tiles have computed the force of the previous step, since the force
+   * computation of neighbors reads the displacement of the tile,
+   *
+   * 2. force and step 3 of the tile start once the tile and its neighboring
+   * tiles have moved, and once the boundary condition is applied if a
+   * neighboring tile holds nodes with boundary condition.
+   *
+   * Thus, tiles can run ahead of slow tiles in other parts of the domain
+   * by up to ModelDeck::d_tileLookahead steps. The result is identical to
+   * integrateVerlet().
+   *
+   * @param nsteps Number of time steps
+   */
+  void integrateTiled(size_t nsteps);
+
+  /*!
+   * @brief Performs time steps of velocity verlet with temporal blocking
+   *
+   * The tiles, ordered along the longest axis of the domain, are grouped
+   * into cache blocks of ModelDeck::d_blockNodes nodes. Each time step has
+   * two phases, step 1 and 2 with the boundary condition, and force with
+   * step 3. Unit (b, q) performs phase q of the block b which is shifted
+   * back by q times the reach w of the tiles, i.e. it covers the tiles
+   * \f$ [b B - q w, (b + 1) B - q w) \f$. Since phase q of a tile only
+   * depends on phase q - 1 of tiles within reach, unit (b, q) only depends
+   * on units (b, q - 1) and (b - 1, q - 1). A block therefore advances all
+   * nsteps steps while its data is in cache, and the blocks form a wavefront
+   * through space and time. The result is identical to integrateVerlet().
+   *
+   * @param nsteps Number of time steps
+   */
+  void integrateWavefront(size_t nsteps);
+
+  /*!
+   * @brief Adds the force time of integrateTiled() or integrateWavefront()
+   * to the force phase of util::Counters
+   *
+   * The force computations of tiles run concurrently and are interleaved
+   * with the integration of other tiles, so only the time summed over the
+   * tasks is known. It is divided by the number of os threads to match the
+   * wall time measured for computeForces().
+   *
+   * @param ns Time of the force computation summed over the tasks in nano
+   * seconds
+   */
+  void addTiledForceTime(std::uint64_t ns);
+
+  /*!
+   * @brief Perform one time step using multirate velocity-verlet scheme
+   *
+   * Node i of level \f$ l_i \f$ is advanced with time step \f$ \Delta t_i =
+   * \Delta t / 2^{l_i} \f$. The time step is divided into \f$ 2^L \f$
+   * substeps of size \f$ \delta = \Delta t / 2^L \f$, L being the finest
+   * level. In every substep
+   *
+   * 1. nodes starting their step get \f$ v_{mid} = v_{old} + \frac{\Delta
+   * t_i}{2} f_{old} / \rho \f$,
+   *
+   * 2. all nodes drift \f$ u = u + \delta v_{mid} \f$,
+   *
+   * 3. nodes ending their step compute their force and get \f$ v_{new} =
+   * v_{mid} + \frac{\Delta t_i}{2} f_{new} / \rho \f$.
+   *
+   * Since all nodes drift every substep, the displacement of a coarse node
+   * seen by the bonds of a fine node is interpolated linearly in time and
+   * fine and coarse regions are coupled through the bond forces at every
+   * substep. Forces are only computed at the end of the step of the node.
+   */
+  void integrateMultirate();
+
+  /*!
+   * @brief Perform one load step using adaptive dynamic relaxation
+   *
+   * The load is advanced by one time step and the displacement is relaxed
+   * to static equilibrium with a fictitious diagonal mass \f$ \lambda_i \f$
+   * and a pseudo time step of one, following Underwood and Kilic & Madenci
+   * (2010):
+   * \f[ v^{n+1/2} = \frac{(2 - c^n) v^{n-1/2} + 2 F^n/\lambda}{2 + c^n},
+   * \qquad u^{n+1} = u^n + v^{n+1/2}. \f]
+   * The damping coefficient is recomputed each iteration from the local
+   * diagonal stiffness estimate
+   * \f[ c^n = 2 \sqrt{\frac{(u^n)^T K^n u^n}{(u^n)^T u^n}}, \qquad
+   * K^n_{ii} = -\frac{F^n_i - F^{n-1}_i}{\lambda_i v^{n-1/2}_i}. \f]
+   * Iterations stop when the norm of the out-of-balance force on free dofs
+   * drops below the tolerance relative to its value at the start of the
+   * load step.
+   */
+  void integrateDR();
+
+  /*!
+   * @brief Computes the fictitious mass of dynamic relaxation
+   *
+   * \f$ \lambda_i = \frac{s}{4} \sum_j |k_{ij}| \f$, where \f$ k_{ij} \f$
+   * is the bond stiffness and \f$ s \ge 1 \f$ the mass factor.
+   */
+  void initDRMass();
+
+  /*!
+   * @brief Computes internal and external forces and returns the norm of
+   * the force on free dofs
+   * @return norm Norm of the out-of-balance force
+   */
+  double computeDRResidual();
+
   /** @}*/
 
   /**
@@ -256,6 +639,27 @@ private:
   /*! @brief flag to stop the simulation midway */
   bool d_stop;
 
+  /*! @brief Flag if mesh is owned by the model */
+  bool d_ownsMesh;
+
+  /*! @brief Flag if neighbor list is owned by the model */
+  bool d_ownsNeighbor;
+
+  /*! @brief Flag if time integration is initialized */
+  bool d_integrationStarted;
+
+  /*! @brief Exchange of ghost displacements (empty if not distributed) */
+  std::function<hpx::future<void>()> d_ghostExchange;
+
+  /*! @brief Flag per node if the node has a ghost neighbor */
+  std::vector<uint8_t> d_ghostBoundary;
+
+  /*! @brief Flag if output interval was changed to small interval */
+  bool d_changedToSmall;
+
+  /*! @brief Flag if output interval was changed back to large interval */
+  bool d_changedBackToLarge;
+
   /**
    * @name Data: High level objects
    */
@@ -267,6 +671,16 @@ private:
   /*! @brief Pointer to Policy object */
   inp::Policy *d_policy_p;
 
+  /*! @brief Bitmask of inp::PolicyTag whose data is populated
+   *
+   * Resolved at the end of init(), after the model has adjusted the tags of
+   * policy.
+   */
+  std::uint32_t d_dataMask;
+
+  /*! @brief Bitmask of inp::OutputTag in the output deck */
+  std::uint32_t d_outMask;
+
   /*! @brief Pointer to InitialCondition object */
   loading::InitialCondition *d_initialCondition_p;
 
@@ -276,9 +690,72 @@ private:
   /*! @brief Pointer to Material object */
   geometry::DampingGeom *d_dampingGeom_p;
 
+  /*! @brief Spatial tiles for tiled time stepping (nullptr if disabled) */
+  geometry::Tiles *d_tiles_p;
+
+  /*! @brief Cell list to enumerate bonds on the fly (nullptr if neighbor
+   * list is stored) */
+  geometry::CellList *d_cellList_p;
+
+  /*! @brief Fracture state of bonds enumerated from the cell list */
+  geometry::SparseFracture *d_sparseFracture_p;
+
+  /*! @brief Tiles holding nodes with displacement or force boundary
+   * condition */
+  std::vector<size_t> d_loadingTiles;
+
+  /*! @brief Flag per tile if its force depends on the boundary condition */
+  std::vector<uint8_t> d_tileLoading;
+
+  /*! @brief Pairs of bc set and node of displacement boundary condition per
+   * tile */
+  std::vector<std::vector<std::pair<size_t, size_t>>> d_tileUBCNodes;
+
+  /*! @brief Pairs of bc set and node of force boundary condition per tile */
+  std::vector<std::vector<std::pair<size_t, size_t>>> d_tileFBCNodes;
+
   /*! @brief Data Manager */
 	data::DataManager *d_dataManager_p;
 
+  /*! @brief Critical time step of nodes */
+  std::vector<double> d_dtCrit;
+
+  /*! @brief Density of nodes if mass scaling is active, else empty */
+  std::vector<double> d_density;
+
+  /*! @brief Time step level of nodes for the multirate scheme */
+  std::vector<size_t> d_level;
+
+  /*! @brief Finest time step level of the multirate scheme */
+  size_t d_finestLevel;
+
+  /*! @brief Total number of bonds in the neighbor list */
+  size_t d_numBonds;
+
+  /*! @brief Time steps reported to the performance counters */
+  size_t d_countedSteps;
+
+  /*! @brief Broken bonds reported to the performance counters */
+  size_t d_countedBrokenBonds;
+
+  /*! @brief Bytes of bonds reported to the performance counters */
+  size_t d_countedBondBytes;
+
+  /*! @brief Partitioner of node loops (nullptr if disabled) */
+  util::WorkPartitioner *d_partitioner_p;
+
+  /*! @brief External force of the multirate scheme */
+  std::vector<util::Point3> d_extForce;
+
+  /*! @brief Fictitious mass of dynamic relaxation */
+  std::vector<double> d_drMass;
+
+  /*! @brief Force at previous dynamic relaxation iteration */
+  std::vector<util::Point3> d_drForceOld;
+
+  /*! @brief Work vectors to reduce nodal quantities */
+  std::vector<double> d_drNum, d_drDen;
+
   /** @}*/
 };
 
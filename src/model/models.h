@@ -6,5 +6,8 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 ////////////////////////////////////////////////////////////////////////////////
 
+#include "dryRun.h"
+#include "ensemble.h"
+#include "fd/distributedFDModel.h"
 #include "fd/fDModel.h"
 #include "quasistatic/QuasiStaticModel.h"
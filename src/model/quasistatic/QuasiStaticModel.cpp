@@ -1,10 +1,14 @@
 #include "QuasiStaticModel.h"
 
 #include <hpx/future.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "BlazeIterative.hpp"
 #include "data/DataManager.h"
+#include "data/fieldRegistry.h"
 #include "fe/mesh.h"
 #include "geometry/neighbor.h"
 #include "geometry/volumeCorrection.h"
@@ -19,12 +23,26 @@
 #include "loading/uLoading.h"
 #include "material/materials.h"
 #include "model/util.h"
+#include "util/compare.h"
+#include "util/fastMethods.h"
+#include "util/multigrid.h"
 #include "util/parallel.h"
+#include "util/profiler.h"
 #include "util/stateBasedHelperFunctions.h"
 
 template <class T>
-model::QuasiStaticModel<T>::QuasiStaticModel(inp::Input *deck)
-    : d_modelDeck_p(nullptr), d_outputDeck_p(nullptr) {
+model::QuasiStaticModel<T>::QuasiStaticModel(inp::Input *deck, bool solve)
+    : d_dynamic(false),
+      d_dtStep(0.),
+      d_dtFactorized(0.),
+      d_timeOld(0.),
+      d_work(0.),
+      d_multigrid_p(nullptr),
+      d_hasFactorization(false),
+      d_itSinceRefresh(0),
+      d_numAssemblies(0),
+      d_modelDeck_p(nullptr),
+      d_outputDeck_p(nullptr) {
   d_osThreads = hpx::get_os_thread_count();
 
   // Generate as many data manager as os threads are avaibale
@@ -53,7 +71,7 @@ model::QuasiStaticModel<T>::QuasiStaticModel(inp::Input *deck)
 
   initHObjects();
 
-  solver();
+  if (solve) solver();
 }
 
 template <class T>
@@ -63,12 +81,13 @@ model::QuasiStaticModel<T>::~QuasiStaticModel() {
   delete d_dataManager_p->getForceLoadingP();
   delete d_dataManager_p->getNeighborP();
   delete d_dataManager_p->getVolumeCorrectionP();
-  delete d_dataManager_p->getBodyForceP();
-  delete d_dataManager_p->getDisplacementP();
-  delete d_dataManager_p->getVelocityP();
 
-  for (size_t i = 0; i < d_osThreads; i++) delete d_dataManagers[i];
+  for (size_t i = 0; i < d_osThreads; i++) {
+    delete d_materials[i];
+    delete d_dataManagers[i];
+  }
 
+  delete d_multigrid_p;
   delete d_material_p;
   delete d_dataManager_p;
 }
@@ -80,25 +99,28 @@ void model::QuasiStaticModel<T>::initHObjects() {
   std::cout << d_name << ": Initializing high level objects." << std::endl;
   // read mesh data
   std::cout << d_name << ": Creating mesh." << std::endl;
-  d_dataManager_p->setMeshP(new fe::Mesh(d_input_p->getMeshDeck()));
+  {
+    util::ScopedTimer timer(util::Phase::MeshRead);
+    d_dataManager_p->setMeshP(new fe::Mesh(d_input_p->getMeshDeck()));
+  }
   d_dataManager_p->getMeshP()->clearElementData();
 
   d_nnodes = d_dataManager_p->getMeshP()->getNumNodes();
 
   std::cout << "Number of nodes = " << d_nnodes << std::endl;
 
-  // initialize major simulation data
+  // initialize major simulation data (owned by the data manager)
+  auto &fields = d_dataManager_p->getFields();
   d_dataManager_p->setBodyForceP(
-      new std::vector<util::Point3>(d_nnodes, util::Point3()));
+      fields.add("Body_Force", d_nnodes, util::Point3()));
 
-  d_dataManager_p->setForceP(
-      new std::vector<util::Point3>(d_nnodes, util::Point3()));
+  d_dataManager_p->setForceP(fields.add("Force", d_nnodes, util::Point3()));
 
   d_dataManager_p->setDisplacementP(
-      new std::vector<util::Point3>(d_nnodes, util::Point3()));
+      fields.add("Displacement", d_nnodes, util::Point3()));
 
   d_dataManager_p->setVelocityP(
-      new std::vector<util::Point3>(d_nnodes, util::Point3()));
+      fields.add("Velocity", d_nnodes, util::Point3()));
 
   // initialize loading class
   std::cout << d_name << ": Initializing displacement loading object."
@@ -110,10 +132,13 @@ void model::QuasiStaticModel<T>::initHObjects() {
       d_input_p->getLoadingDeck(), d_dataManager_p->getMeshP()));
   // initialize neighbor class class
   std::cout << d_name << ": Creating neighbor list." << std::endl;
-
-  d_dataManager_p->setNeighborP(new geometry::Neighbor(
-      d_dataManager_p->getModelDeckP()->d_horizon, d_input_p->getNeighborDeck(),
-      d_dataManager_p->getMeshP()->getNodesP()));
+  {
+    util::ScopedTimer timer(util::Phase::NeighborBuild);
+    d_dataManager_p->setNeighborP(new geometry::Neighbor(
+        d_dataManager_p->getModelDeckP()->d_horizon,
+        d_input_p->getNeighborDeck(),
+        d_dataManager_p->getMeshP()->getNodesP()));
+  }
 
   // initialize the volume correction and weighted volumes
   d_dataManager_p->setVolumeCorrectionP(
@@ -121,26 +146,40 @@ void model::QuasiStaticModel<T>::initHObjects() {
 
   // initialize material class
   std::cout << d_name << ": Initializing material object." << std::endl;
+  {
+    util::ScopedTimer timer(util::Phase::MaterialInit);
+    d_material_p = new T(d_input_p->getMaterialDeck(), d_dataManager_p);
+  }
 
-  d_material_p = new T(d_input_p->getMaterialDeck(), d_dataManager_p);
+  // build the map of free degrees of freedom
+  initDofMap();
 
   // initialize jacobian matrix
-  size_t dim = d_dataManager_p->getModelDeckP()->d_dim;
-  size_t matrixSize = d_nnodes * dim;
-  std::cout << d_name << ": Initializing Jacobian matrix (" << matrixSize << "x"
-            << matrixSize << ")." << std::endl;
-  jacobian = util::Matrixij(matrixSize, matrixSize, 0.);
+  std::cout << d_name << ": Initializing Jacobian matrix (" << d_nFreeDofs
+            << "x" << d_nFreeDofs << ")." << std::endl;
+  jacobian = util::Matrixij(d_nFreeDofs, d_nFreeDofs, 0.);
+
+  // build the multigrid hierarchy from the mesh
+  const auto *solverDeck = d_input_p->getSolverDeck();
+  if (solverDeck->d_preconditioner == "multigrid")
+    d_multigrid_p = new util::GeometricMultigrid(
+        d_dataManager_p->getMeshP()->getNodes(),
+        d_dataManager_p->getMeshP()->getNodalVolumes(), d_dofMap,
+        d_dataManager_p->getModelDeckP()->d_dim,
+        d_dataManager_p->getMeshP()->getMeshSize(), solverDeck->d_mgMaxLevels,
+        solverDeck->d_mgCoarseSize, solverDeck->d_mgSmoothingSteps);
 
   for (size_t i = 0; i < d_osThreads; i++) {
     d_dataManagers[i]->setMeshP(d_dataManager_p->getMeshP());
+    auto &threadFields = d_dataManagers[i]->getFields();
     d_dataManagers[i]->setBodyForceP(
-        new std::vector<util::Point3>(d_nnodes, util::Point3()));
+        threadFields.add("Body_Force", d_nnodes, util::Point3()));
     d_dataManagers[i]->setForceP(
-        new std::vector<util::Point3>(d_nnodes, util::Point3()));
+        threadFields.add("Force", d_nnodes, util::Point3()));
     d_dataManagers[i]->setDisplacementP(
-        new std::vector<util::Point3>(d_nnodes, util::Point3()));
+        threadFields.add("Displacement", d_nnodes, util::Point3()));
     d_dataManagers[i]->setVelocityP(
-        new std::vector<util::Point3>(d_nnodes, util::Point3()));
+        threadFields.add("Velocity", d_nnodes, util::Point3()));
 
     d_dataManagers[i]->setForceLoadingP(d_dataManager_p->getForceLoadingP());
     d_dataManagers[i]->setDisplacementLoadingP(
@@ -148,192 +187,269 @@ void model::QuasiStaticModel<T>::initHObjects() {
     d_dataManagers[i]->setVolumeCorrectionP(
         d_dataManager_p->getVolumeCorrectionP());
     d_dataManagers[i]->setNeighborP(d_dataManager_p->getNeighborP());
+    d_dataManagers[i]->setShapeTensorP(d_dataManager_p->getShapeTensorP());
+    d_dataManagers[i]->setShapeTensorInvP(
+        d_dataManager_p->getShapeTensorInvP());
   }
 
+  // bond lists for the lock-free force assembly
+  initBondLists();
+
+  // material objects used for the perturbed force computations, one per
+  // os thread, so that their internal state is allocated only once
+  for (size_t i = 0; i < d_osThreads; i++)
+    d_materials.push_back(
+        new T(d_input_p->getMaterialDeck(), d_dataManagers[i]));
+
+  const auto output = data::FieldLifetime::Output;
   if (d_dataManager_p->getOutputDeckP()->isTagInOutput("Strain_Energy")) {
-    d_dataManager_p->setStrainEnergyP(new std::vector<float>(d_nnodes, 0.));
+    d_dataManager_p->setStrainEnergyP(
+        fields.add("Strain_Energy", d_nnodes, 0.f, output));
   }
 
   if (d_dataManager_p->getOutputDeckP()->isTagInOutput("Stress_Tensor")) {
-    d_dataManager_p->setStressTensorP(
-        new std::vector<util::Matrix33>(d_nnodes));
+    d_dataManager_p->setStressTensorP(fields.add(
+        "Stress_Tensor", d_nnodes, util::Matrix33(), output));
   }
 
   if (d_dataManager_p->getOutputDeckP()->isTagInOutput("Strain_Tensor")) {
-    d_dataManager_p->setStrainTensorP(
-        new std::vector<util::Matrix33>(d_nnodes));
+    d_dataManager_p->setStrainTensorP(fields.add(
+        "Strain_Tensor", d_nnodes, util::Matrix33(), output));
   }
+
+  fields.print();
 }
 
 template <class T>
-void model::QuasiStaticModel<T>::computeForces(bool full) {
-  d_material_p->update();
+void model::QuasiStaticModel<T>::initBondLists() {
+  auto *neighbors = d_dataManager_p->getNeighborP();
+
+  // list of bonds (i, local id of j in the neighbor list of i) pointing to
+  // node j
+  d_incomingBonds =
+      std::vector<std::vector<std::pair<size_t, size_t>>>(d_nnodes);
 
-  // Clear the vector
+  for (size_t i = 0; i < d_nnodes; i++) {
+    const auto &i_neighs = neighbors->getNeighbors(i);
+    for (size_t k = 0; k < i_neighs.size(); k++)
+      d_incomingBonds[i_neighs[k]].emplace_back(i, k);
+  }
 
-  hpx::experimental::for_loop(hpx::execution::par, 0, d_nnodes,
-                              [&](boost::uint64_t i) {
-                                (*d_dataManager_p->getForceP())[i].d_x = 0.;
-                                (*d_dataManager_p->getForceP())[i].d_y = 0.;
-                                (*d_dataManager_p->getForceP())[i].d_z = 0.;
-                              });
+  // storage for the bond forces aligned with the neighbor list
+  d_bondForces = std::vector<std::vector<util::Point3>>(d_nnodes);
+  for (size_t i = 0; i < d_nnodes; i++)
+    d_bondForces[i].resize(neighbors->getNeighbors(i).size());
 
-  hpx::mutex m;
+  d_threadBondForces =
+      std::vector<std::vector<std::vector<util::Point3>>>(d_osThreads,
+                                                          d_bondForces);
+}
 
+template <class T>
+void model::QuasiStaticModel<T>::assembleForces(
+    material::pd::BaseMaterial *material, data::DataManager *dataManager,
+    std::vector<std::vector<util::Point3>> &bondForces, bool full) {
+  // update the material state node by node within the force sweep if possible
+  bool nodeUpdate = material->hasNodeUpdate();
+
+  if (!nodeUpdate) material->update();
+
+  const auto *neighbors = d_dataManager_p->getNeighborP();
+  const auto &vols = *d_dataManager_p->getMeshP()->getNodalVolumesP();
+  auto &force = *dataManager->getForceP();
+
+  bool strainEnergy =
+      full and d_dataManager_p->getOutputDeckP()->isTagInOutput("Strain_Energy");
+  bool strainTensor =
+      full and d_dataManager_p->getOutputDeckP()->isTagInOutput("Strain_Tensor");
+  bool stressTensor =
+      full and d_dataManager_p->getOutputDeckP()->isTagInOutput("Stress_Tensor");
+
+  // Each node only writes its own data, so no locking is needed. First, the
+  // bond forces of node i are computed and stored per bond.
   hpx::experimental::for_loop(
-      hpx::execution::par, 0, d_nnodes,
-      [&](boost::uint64_t i) {
+      hpx::execution::par, 0, d_nnodes, [&](boost::uint64_t i) {
         util::Point3 force_i = util::Point3();
+        double energy_i = 0.;
+
+        if (nodeUpdate) material->updateNode(i);
 
         // inner loop over neighbors
-        std::vector<std::size_t> i_neighs =
-            d_dataManager_p->getNeighborP()->getNeighbors(i);
+        const auto &i_neighs = neighbors->getNeighbors(i);
 
         for (size_t j = 0; j < i_neighs.size(); j++) {
-          size_t j_id = i_neighs[j];
-
-          auto res = d_material_p->getBondEF(size_t(i), size_t(j));
-
-          force_i += res.first *
-                     (*d_dataManager_p->getMeshP()->getNodalVolumesP())[j_id];
-
-          m.lock();
-          (*d_dataManager_p->getForceP())[j_id] -=
-              res.first * (*d_dataManager_p->getMeshP()->getNodalVolumesP())[i];
-          m.unlock();
-
-          if (full) {
-            if (d_dataManager_p->getOutputDeckP()->isTagInOutput(
-                    "Strain_Energy"))
+          auto res = material->getBondEF(size_t(i), size_t(j));
 
-            {
-              (*d_dataManager_p->getStrainEnergyP())[i] += (float)res.second;
-            }
-          }
+          bondForces[i][j] = res.first;
+          force_i += res.first * vols[i_neighs[j]];
+          energy_i += res.second;
         }
 
-        if (full) {
-          if (d_dataManager_p->getOutputDeckP()->isTagInOutput("Strain_Tensor"))
+        force[i] = force_i;
 
-          {
-            (*d_dataManager_p->getStrainTensorP())[i] =
-                d_material_p->getStrain(size_t(i));
-          }
+        if (strainEnergy)
+          (*d_dataManager_p->getStrainEnergyP())[i] = (float)energy_i;
+
+        if (strainTensor or stressTensor) {
+          // compute the strain once and reuse it for the stress
+          util::Matrix33 strain = material->getStrain(size_t(i));
 
-          if (d_dataManager_p->getOutputDeckP()->isTagInOutput("Stress_Tensor"))
+          if (strainTensor) (*d_dataManager_p->getStrainTensorP())[i] = strain;
 
-          {
+          if (stressTensor)
             (*d_dataManager_p->getStressTensorP())[i] =
-                d_material_p->getStress(size_t(i));
-          }
+                material->getStress(size_t(i), strain);
         }
+      });
 
-        // update force and energy
-        m.lock();
+  // Second, node j gathers the reaction of all bonds pointing to it
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, d_nnodes, [&](boost::uint64_t j) {
+        util::Point3 force_j = util::Point3();
 
-        (*d_dataManager_p->getForceP())[i] += force_i;
-        m.unlock();
-      }  // loop over nodes
+        for (const auto &bond : d_incomingBonds[j])
+          force_j -= bondForces[bond.first][bond.second] * vols[bond.first];
 
-  );  // end of parallel for loop
+        force[j] += force_j;
+      });
 }
 
 template <class T>
-inline void model::QuasiStaticModel<T>::computePertubatedForces(size_t thread) {
-  material::pd::BaseMaterial *material =
-      new T(d_input_p->getMaterialDeck(), d_dataManagers[thread]);
+void model::QuasiStaticModel<T>::assembleForcesLocked(
+    material::pd::BaseMaterial *material, data::DataManager *dataManager) {
+  bool nodeUpdate = material->hasNodeUpdate();
 
-  material->update();
+  if (!nodeUpdate) material->update();
 
-  // Clear the vector
+  const auto *neighbors = d_dataManager_p->getNeighborP();
+  const auto &vols = *d_dataManager_p->getMeshP()->getNodalVolumesP();
+  auto &force = *dataManager->getForceP();
 
   hpx::experimental::for_loop(
-      hpx::execution::par, 0, d_nnodes, [&](boost::uint64_t i) {
-        (*d_dataManagers[thread]->getForceP())[i].d_x = 0.;
-        (*d_dataManagers[thread]->getForceP())[i].d_y = 0.;
-        (*d_dataManagers[thread]->getForceP())[i].d_z = 0.;
-      });
+      hpx::execution::par, 0, d_nnodes,
+      [&](boost::uint64_t i) { force[i] = util::Point3(); });
 
   hpx::mutex m;
 
   hpx::experimental::for_loop(
-      hpx::execution::par, 0, d_nnodes,
-      [&](boost::uint64_t i) {
+      hpx::execution::par, 0, d_nnodes, [&](boost::uint64_t i) {
         util::Point3 force_i = util::Point3();
 
+        if (nodeUpdate) material->updateNode(i);
+
         // inner loop over neighbors
-        std::vector<std::size_t> i_neighs =
-            d_dataManager_p->getNeighborP()->getNeighbors(i);
+        const auto &i_neighs = neighbors->getNeighbors(i);
 
         for (size_t j = 0; j < i_neighs.size(); j++) {
           size_t j_id = i_neighs[j];
 
           auto res = material->getBondEF(size_t(i), size_t(j));
 
-          force_i += res.first *
-                     (*d_dataManager_p->getMeshP()->getNodalVolumesP())[j_id];
+          force_i += res.first * vols[j_id];
 
           m.lock();
-          (*d_dataManagers[thread]->getForceP())[j_id] -=
-              res.first * (*d_dataManager_p->getMeshP()->getNodalVolumesP())[i];
+          force[j_id] -= res.first * vols[i];
           m.unlock();
         }
-        // update force and energy
-        m.lock();
 
-        (*d_dataManagers[thread]->getForceP())[i] += force_i;
+        m.lock();
+        force[i] += force_i;
         m.unlock();
-      }  // loop over nodes
-
-  );  // end of parallel for loop
-
-  delete material;
+      });
 }
 
 template <class T>
-void model::QuasiStaticModel<T>::removeRow(util::Matrixij &matrix,
-                                           size_t rowToRemove) {
-  for (size_t i = 0; i < matrix.rows(); i++)
+std::pair<double, double> model::QuasiStaticModel<T>::timeForces(
+    size_t repeat) {
+  repeat = std::max(repeat, size_t(1));
+
+  // smooth displacement which is not affine, so that all bonds carry a force
+  const size_t dim = d_dataManager_p->getModelDeckP()->d_dim;
+  const auto &nodes = d_dataManager_p->getMeshP()->getNodes();
+  auto &u = *d_dataManager_p->getDisplacementP();
+  for (size_t i = 0; i < d_nnodes; i++)
+    for (size_t d = 0; d < dim; d++)
+      u[i][d] = 1.0e-3 * nodes[i][d] * nodes[i][d];
+
+  computeForces();  // warm up
+  std::uint64_t begin = hpx::chrono::high_resolution_clock::now();
+  for (size_t k = 0; k < repeat; k++) computeForces();
+  const double lockFree =
+      double(hpx::chrono::high_resolution_clock::now() - begin) / 1.0e9 /
+      double(repeat);
+
+  // the reference assembly works on the data of the first perturbation
+  // thread
+  auto *dataManager = d_dataManagers[0];
+  *dataManager->getDisplacementP() = u;
+
+  assembleForcesLocked(d_materials[0], dataManager);  // warm up
+  begin = hpx::chrono::high_resolution_clock::now();
+  for (size_t k = 0; k < repeat; k++)
+    assembleForcesLocked(d_materials[0], dataManager);
+  const double locked =
+      double(hpx::chrono::high_resolution_clock::now() - begin) / 1.0e9 /
+      double(repeat);
+
+  // both assemblies only differ in the order of summation
+  const auto &force = *d_dataManager_p->getForceP();
+  const auto &forceLocked = *dataManager->getForceP();
+  double diff = 0.;
+  double norm = 0.;
+  for (size_t i = 0; i < d_nnodes; i++) {
+    diff = std::max(diff, (force[i] - forceLocked[i]).length());
+    norm = std::max(norm, force[i].length());
+  }
 
-    for (size_t j = rowToRemove; j < matrix.columns() - 1; j++)
+  if (diff > 1.0e-10 * norm) {
+    std::cerr << "Error: Lock-free and mutex force assembly differ by " << diff
+              << " (maximal force " << norm << ").\n";
+    exit(1);
+  }
 
-      matrix(j, i) = matrix(j + 1, i);
+  return {lockFree, locked};
+}
 
-  matrix.resize(matrix.rows() - 1, matrix.columns(), false);
-  matrix.shrinkToFit();
+template <class T>
+void model::QuasiStaticModel<T>::computeForces(bool full) {
+  util::ScopedTimer timer(util::Phase::Force);
+  assembleForces(d_material_p, d_dataManager_p, d_bondForces, full);
 }
 
 template <class T>
-void model::QuasiStaticModel<T>::removeCol(util::Matrixij &matrix,
-                                           size_t colToRemove) {
-  for (size_t i = 0; i < matrix.rows(); i++)
+inline void model::QuasiStaticModel<T>::computePertubatedForces(size_t thread) {
+  assembleForces(d_materials[thread], d_dataManagers[thread],
+                 d_threadBondForces[thread]);
+}
 
-    for (size_t j = colToRemove; j < matrix.columns() - 1; j++)
+template <class T>
+void model::QuasiStaticModel<T>::initDofMap() {
+  size_t dim = d_dataManager_p->getModelDeckP()->d_dim;
 
-      matrix(i, j) = matrix(i, j + 1);
+  d_dofMap = std::vector<long int>(d_nnodes * dim, 0);
 
-  matrix.resize(matrix.rows(), matrix.columns() - 1, true);
-  matrix.shrinkToFit();
-}
+  // mark constrained DOFs
+  const auto &bcD = d_dataManager_p->getDisplacementLoadingP()->d_bcData;
+  const auto &bcN = d_dataManager_p->getDisplacementLoadingP()->d_bcNodes;
 
-template <class T>
-void model::QuasiStaticModel<T>::removeRow(util::VectorXi &vector,
-                                           size_t rowToRemove) {
-  for (size_t i = rowToRemove; i < vector.size() - 1; i++)
+  for (size_t k = 0; k < bcD.size(); k++)
+    for (auto d : bcD[k].d_direction)
+      for (auto n : bcN[k]) d_dofMap[n * dim + d - 1] = -1;
 
-    vector[i] = vector[i + 1];
+  // number the free DOFs consecutively
+  d_nFreeDofs = 0;
+  for (auto &id : d_dofMap)
+    if (id != -1) id = d_nFreeDofs++;
 
-  vector.resize(vector.size() - 1, false);
-  vector.shrinkToFit();
+  std::cout << d_name << ": Number of free DOFs = " << d_nFreeDofs << " of "
+            << d_dofMap.size() << std::endl;
 }
 
 template <class T>
 void model::QuasiStaticModel<T>::assembly_jacobian_matrix() {
-  size_t dim = d_dataManager_p->getModelDeckP()->d_dim;
-  size_t matrixSize = d_nnodes * dim;
-
-  jacobian.resize(matrixSize, matrixSize);
+  jacobian.resize(d_nFreeDofs, d_nFreeDofs);
   reset(jacobian);
+  d_numAssemblies++;
 
   size_t slice = int(d_nnodes / d_osThreads);
 
@@ -356,6 +472,16 @@ void model::QuasiStaticModel<T>::assembly_jacobian_matrix() {
   for (size_t i = 0; i < futures.size(); i++) futures[i].get();
 
   // hpx::when_all(futures);
+
+  // contribution of the inertia to the Jacobian of the dynamic residual
+  if (d_dynamic) {
+    const auto *modelDeck = d_dataManager_p->getModelDeckP();
+    double mass = d_material_p->getDensity() /
+                  (modelDeck->d_newmarkBeta * d_dtStep * d_dtStep);
+
+    jacobian *= 1. + modelDeck->d_hhtAlpha;
+    for (size_t k = 0; k < d_nFreeDofs; k++) jacobian(k, k) -= mass;
+  }
 }
 
 template <class T>
@@ -371,277 +497,622 @@ inline void model::QuasiStaticModel<T>::assembly_jacobian_matrix_part(
   util::parallel::copy<std::vector<util::Point3>>(
       *d_dataManager_p->getDisplacementP(), backup);
 
-  std::vector<size_t> removeId;
+  for (size_t i = begin; i < end; i++) {
+    // skip nodes whose DOFs are all constrained
+    bool hasFreeDof = false;
+    for (size_t r = 0; r < dim; r++)
+      if (d_dofMap[i * dim + r] != -1) hasFreeDof = true;
+
+    if (!hasFreeDof) continue;
+
+    std::vector<size_t> traversal_list;
+    traversal_list.push_back(i);
+
+    const auto &i_neighs = d_dataManager_p->getNeighborP()->getNeighbors(i);
+    for (auto j : i_neighs) traversal_list.push_back(j);
+
+    for (auto j : traversal_list) {
+      for (size_t r = 0; r < dim; r++) {
+        long int row = d_dofMap[i * dim + r];
+        long int col = d_dofMap[j * dim + r];
+
+        // constrained DOFs are not part of the reduced system
+        if (row == -1 or col == -1) continue;
+
+        std::vector<util::Point3> eps_vector =
+            std::vector<util::Point3>(d_nnodes, util::Point3());
+
+        switch (r) {
+          case 0:
+            eps_vector[j].d_x = eps;
+            break;
+          case 1:
+            eps_vector[j].d_y = eps;
+            break;
+          case 2:
+            eps_vector[j].d_z = eps;
+            break;
+        }
+
+        std::vector<util::Point3> *tmp =
+            new std::vector<util::Point3>(d_nnodes, util::Point3());
+        util::parallel::copy(backup, *tmp);
+        util::parallel::addInplace(*tmp, eps_vector);
 
-  // get instance of ULoading class (d_uLoading_p)
-  auto bcD = d_dataManager_p->getDisplacementLoadingP()->d_bcData;
-  auto bcN = d_dataManager_p->getDisplacementLoadingP()->d_bcNodes;
+        d_dataManagers[thread]->setDisplacementP(tmp);
 
-  // get fixed nodes
-  size_t k = 0;
-  for (auto bc : bcD) {
-    auto direction = bc.d_direction;
+        computePertubatedForces(thread);
 
-    for (auto d : direction) {
-      for (auto n : bcN[k]) {
-        removeId.push_back(n);
+        util::Point3 force_p = (*d_dataManagers[thread]->getForceP())[i];
+
+        util::parallel::copy(backup, *tmp);
+        util::parallel::subInplace(*tmp, eps_vector);
+
+        d_dataManagers[thread]->setDisplacementP(tmp);
+
+        computePertubatedForces(thread);
+
+        util::Point3 force_m = (*d_dataManagers[thread]->getForceP())[i];
+
+        util::Point3 f_diff = force_p - force_m;
+
+        delete tmp;
+
+        jacobian(row, col) = f_diff[r] / (2. * eps);
       }
     }
-    k++;
   }
+}
 
-  for (size_t i = begin; i < end; i++) {
-    if (!(std::find(removeId.begin(), removeId.end(), i) != removeId.end())) {
-      std::vector<size_t> *traversal_list = new std::vector<size_t>;
+template <class T>
+void model::QuasiStaticModel<T>::factorize_jacobian() {
+  this->assembly_jacobian_matrix();
 
-      traversal_list->push_back(i);
+  d_jacobianLU = jacobian;
+  d_pivots.resize(d_nFreeDofs);
+  blaze::getrf(d_jacobianLU, d_pivots.data());
 
-      std::vector<size_t> i_neighs =
-          d_dataManager_p->getNeighborP()->getNeighbors(i);
-      for (auto j : i_neighs) traversal_list->push_back(j);
+  d_hasFactorization = true;
+  d_itSinceRefresh = 0;
+  d_dtFactorized = d_dtStep;
 
-      for (auto j : *traversal_list) {
-        for (size_t r = 0; r < dim; r++) {
-          std::vector<util::Point3> eps_vector =
-              std::vector<util::Point3>(d_nnodes, util::Point3());
-
-          switch (r) {
-            case 0:
-              eps_vector[j].d_x = eps;
-              break;
-            case 1:
-              eps_vector[j].d_y = eps;
-              break;
-            case 2:
-              eps_vector[j].d_z = eps;
-              break;
-          }
+  // the quasi-Newton updates refer to the old Jacobian
+  d_historyS.clear();
+  d_historyY.clear();
+
+  std::cout << d_name << ": Jacobian matrix assembled and factorized."
+            << std::endl;
+}
 
-          std::vector<util::Point3> *tmp =
-              new std::vector<util::Point3>(d_nnodes, util::Point3());
-          util::parallel::copy(backup, *tmp);
-          util::parallel::addInplace(*tmp, eps_vector);
+template <class T>
+util::VectorXi model::QuasiStaticModel<T>::solve_factorized(
+    const util::VectorXi &v, bool trans) {
+  util::VectorXi x = v;
+  blaze::getrs(d_jacobianLU, x, trans ? 'T' : 'N', d_pivots.data());
+  return x;
+}
 
-          d_dataManagers[thread]->setDisplacementP(tmp);
+template <class T>
+util::VectorXi model::QuasiStaticModel<T>::apply_broyden(const util::VectorXi &v,
+                                                         bool trans) {
+  // H = H_0 + sum_i s_i y_i^T with H_0 the inverse of the factorized Jacobian
+  util::VectorXi x = solve_factorized(v, trans);
+
+  for (size_t i = 0; i < d_historyS.size(); i++) {
+    if (trans)
+      x += d_historyY[i] * blaze::dot(d_historyS[i], v);
+    else
+      x += d_historyS[i] * blaze::dot(d_historyY[i], v);
+  }
 
-          computePertubatedForces(thread);
+  return x;
+}
 
-          util::Point3 force_p = (*d_dataManagers[thread]->getForceP())[i];
+template <class T>
+util::VectorXi model::QuasiStaticModel<T>::bfgs_step(const util::VectorXi &res) {
+  // The Jacobian of the residual is negative definite, so the recursion
+  // works with the gradient g = -res and the stiffness K = -J
+  size_t m = d_historyS.size();
+  std::vector<double> alpha(m, 0.), rho(m, 0.);
+
+  util::VectorXi q = -res;
+
+  for (size_t k = m; k-- > 0;) {
+    rho[k] = 1. / blaze::dot(d_historyY[k], d_historyS[k]);
+    alpha[k] = rho[k] * blaze::dot(d_historyS[k], q);
+    q -= alpha[k] * d_historyY[k];
+  }
 
-          util::parallel::copy(backup, *tmp);
-          util::parallel::subInplace(*tmp, eps_vector);
+  // initial approximation K_0^{-1} q = -J_0^{-1} q
+  util::VectorXi z = -solve_factorized(q);
 
-          d_dataManagers[thread]->setDisplacementP(tmp);
+  for (size_t k = 0; k < m; k++) {
+    double beta = rho[k] * blaze::dot(d_historyY[k], z);
+    z += d_historyS[k] * (alpha[k] - beta);
+  }
 
-          computePertubatedForces(thread);
+  return -z;
+}
 
-          util::Point3 force_m = (*d_dataManagers[thread]->getForceP())[i];
+template <class T>
+void model::QuasiStaticModel<T>::reset_newton() {
+  d_prevRes.clear();
+  d_prevStep.clear();
+  d_historyS.clear();
+  d_historyY.clear();
+
+  if (!d_input_p->getSolverDeck()->d_reuseAcrossSteps)
+    d_hasFactorization = false;
+}
 
-          util::Point3 f_diff = force_p - force_m;
+template <class T>
+util::VectorXi model::QuasiStaticModel<T>::newton_step(
+    const util::VectorXi &res) {
+  const auto *solverDeck = d_input_p->getSolverDeck();
 
-          delete tmp;
+  util::VectorXi x = util::VectorXi(res.size(), 0.);
 
-          for (size_t s = 0; s < dim; s++) {
-            if (r == s)
-              jacobian(i * dim + r, j * dim + s) = f_diff[r] / (2. * eps);
+  if (solverDeck->d_newtonType == "full") {
+    this->assembly_jacobian_matrix();
+
+    if (d_multigrid_p) {
+      size_t its = 0;
+      double linearRes = 0.;
+      d_multigrid_p->setup(jacobian);
+      x = d_multigrid_p->solve(util::VectorXi(-res),
+                               solverDeck->d_solverType == "BiCGSTAB",
+                               solverDeck->d_linearTol,
+                               solverDeck->d_linearMaxIters, its, linearRes);
+      std::cout << d_name << ": Multigrid preconditioned solver iterations = "
+                << its << std::endl;
+      if (linearRes > solverDeck->d_linearTol)
+        std::cout << "Warning: Multigrid preconditioned solver did not "
+                     "converge in "
+                  << its << " iterations, relative residual = " << linearRes
+                  << ".\n";
+    } else if (solverDeck->d_solverType == "BiCGSTAB") {
+      blaze::iterative::BiCGSTABTag tag;
+      x = blaze::iterative::solve(jacobian, util::VectorXi(-res), tag);
+    } else {
+      blaze::iterative::ConjugateGradientTag tag;
+      x = blaze::iterative::solve(jacobian, util::VectorXi(-res), tag);
+    }
+  } else {
+    bool hasPrevious = d_prevRes.size() == res.size();
+
+    // reassemble the Jacobian if there is none, after the given number of
+    // iterations, or if the convergence stagnates
+    bool refresh = !d_hasFactorization;
+
+    if (solverDeck->d_refreshInterval > 0 and
+        d_itSinceRefresh >= solverDeck->d_refreshInterval)
+      refresh = true;
+
+    if (hasPrevious and util::l2Norm(res) >
+                            solverDeck->d_stagnationRatio * util::l2Norm(d_prevRes))
+      refresh = true;
+
+    if (refresh)
+      factorize_jacobian();
+    else if (hasPrevious) {
+      // update the approximation with the previous step
+      util::VectorXi y = res - d_prevRes;
+      const util::VectorXi &s = d_prevStep;
+
+      if (solverDeck->d_newtonType == "bfgs") {
+        // store the pair if the curvature condition holds
+        util::VectorXi g = -y;
+        if (solverDeck->d_historySize > 0 and
+            blaze::dot(g, s) > std::numeric_limits<double>::epsilon() *
+                                   util::l2Norm(g) * util::l2Norm(s)) {
+          // drop the oldest pair
+          if (d_historyS.size() >= solverDeck->d_historySize) {
+            d_historyS.erase(d_historyS.begin());
+            d_historyY.erase(d_historyY.begin());
           }
+
+          d_historyS.push_back(s);
+          d_historyY.push_back(g);
         }
-      }
+      } else if (solverDeck->d_newtonType == "broyden") {
+        // good Broyden update of the inverse
+        // H_+ = H + (s - H y) (H^T s)^T / (s^T H y)
+        if (d_historyS.size() >= solverDeck->d_historySize) {
+          // the update vectors depend on each other, so restart instead
+          d_historyS.clear();
+          d_historyY.clear();
+        }
+
+        util::VectorXi Hy = apply_broyden(y);
+        double denom = blaze::dot(s, Hy);
 
-      delete traversal_list;
+        if (solverDeck->d_historySize > 0 and
+            std::abs(denom) > std::numeric_limits<double>::epsilon() *
+                                  util::l2Norm(s) * util::l2Norm(Hy)) {
+          util::VectorXi HTs = apply_broyden(s, true);
+          d_historyS.push_back((s - Hy) / denom);
+          d_historyY.push_back(HTs);
+        }
+      }
     }
+
+    if (solverDeck->d_newtonType == "bfgs")
+      x = bfgs_step(res);
+    else if (solverDeck->d_newtonType == "broyden")
+      x = -apply_broyden(res);
+    else
+      x = -solve_factorized(res);
+
+    d_itSinceRefresh++;
   }
+
+  d_prevRes = res;
+  d_prevStep = x;
+
+  // scatter the reduced solution back to the global DOFs
+  util::VectorXi new_disp = util::VectorXi(d_dofMap.size(), 0.);
+
+  for (size_t i = 0; i < d_dofMap.size(); i++)
+    if (d_dofMap[i] != -1) new_disp[i] = x[d_dofMap[i]];
+
+  return new_disp;
 }
 
 template <class T>
-util::VectorXi model::QuasiStaticModel<T>::newton_step(util::VectorXi &res) {
-  this->assembly_jacobian_matrix();
+void model::QuasiStaticModel<T>::add_displacement(const util::VectorXi &du,
+                                                  double scale) {
+  size_t dim = d_dataManager_p->getModelDeckP()->d_dim;
+
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, d_nnodes, [&](boost::uint64_t i) {
+        size_t id = i * dim;
 
-  std::vector<size_t> removeId;
+        (*d_dataManager_p->getDisplacementP())[i].d_x += scale * du[id];
+        if (dim >= 2)
+          (*d_dataManager_p->getDisplacementP())[i].d_y += scale * du[id + 1];
+        if (dim == 3)
+          (*d_dataManager_p->getDisplacementP())[i].d_z += scale * du[id + 2];
+      });
+}
 
-  // get instance of ULoading class (d_uLoading_p)
-  auto bcD = d_dataManager_p->getDisplacementLoadingP()->d_bcData;
-  auto bcN = d_dataManager_p->getDisplacementLoadingP()->d_bcNodes;
+template <class T>
+double model::QuasiStaticModel<T>::line_search(const util::VectorXi &new_disp,
+                                               util::VectorXi &res) {
+  const auto *solverDeck = d_input_p->getSolverDeck();
 
-  // get dimension
-  auto dim = d_dataManager_p->getModelDeckP()->d_dim;
+  double residual0 = util::l2Norm(res);
 
-  size_t k = 0;
-  for (auto bc : bcD) {
-    auto direction = bc.d_direction;
+  // full step
+  double alpha = 1.;
+  add_displacement(new_disp, alpha);
+  this->computeForces();
+  res = this->computeResidual();
 
-    for (auto d : direction) {
-      for (auto n : bcN[k]) {
-        removeId.push_back(n * dim + d - 1);
-      }
-    }
-    k++;
+  if (!solverDeck->d_lineSearch) return alpha;
+
+  // backtrack until the residual norm decreases sufficiently
+  size_t it = 0;
+  double residual = util::l2Norm(res);
+
+  while (!(residual <= (1. - solverDeck->d_lineSearchDecrease * alpha) *
+                           residual0) and
+         it < solverDeck->d_lineSearchMaxIters) {
+    add_displacement(new_disp, -0.5 * alpha);
+    alpha *= 0.5;
+
+    this->computeForces();
+    res = this->computeResidual();
+    residual = util::l2Norm(res);
+    it++;
   }
 
-  std::sort(removeId.begin(), removeId.end());
-  std::reverse(removeId.begin(), removeId.end());
+  if (it > 0)
+    std::cout << "Line search: step length = " << alpha << std::endl;
+
+  return alpha;
+}
+
+template <class T>
+bool model::QuasiStaticModel<T>::solve_load_step(size_t &iteration) {
+  const auto *solverDeck = d_input_p->getSolverDeck();
+
+  // Apply the force loading
+  util::parallel::fill(*d_dataManager_p->getBodyForceP(), util::Point3());
+  d_dataManager_p->getForceLoadingP()->apply(
+      d_time, d_dataManager_p->getBodyForceP(), d_dataManager_p->getMeshP());
 
-  for (auto id : removeId) {
-    this->removeRow(jacobian, id);
-    this->removeCol(jacobian, id);
-    this->removeRow(res, id);
+  if (d_dynamic) {
+    d_dtStep = d_time - d_timeOld;
+    predict_dynamics();
   }
 
-  util::VectorXi x = util::VectorXi(res.size(), 0.);
+  // Apply the displacement loading
+  d_dataManager_p->getDisplacementLoadingP()->apply(
+      d_time, d_dataManager_p->getDisplacementP(),
+      d_dataManager_p->getVelocityP(), d_dataManager_p->getMeshP());
 
-  blaze::iterative::ConjugateGradientTag tag;
+  reset_newton();
 
-  if (d_input_p->getSolverDeck()->d_solverType == "BiCGSTAB")
-    blaze::iterative::BiCGSTABTag tag;
+  // the inertia term of the factorized Jacobian depends on the time step
+  if (d_dynamic and d_dtFactorized != d_dtStep) d_hasFactorization = false;
 
-  res *= -1.;
+  this->computeForces();
 
-  x = blaze::iterative::solve(jacobian, res, tag);
+  auto res = this->computeResidual();
 
-  std::vector<bool> mask = std::vector<bool>(
-      d_nnodes * d_dataManager_p->getModelDeckP()->d_dim, true);
+  iteration = 0;
 
-  for (size_t i = 0; i < mask.size(); i++) {
-    if (std::find(removeId.begin(), removeId.end(), i) != removeId.end())
-      mask[i] = false;
-  }
+  double residual = util::l2Norm(res);
 
-  util::VectorXi new_disp =
-      util::VectorXi(d_nnodes * d_dataManager_p->getModelDeckP()->d_dim, 0.);
+  std::cout << "It: " << iteration << " Res: " << residual << std::endl;
 
-  size_t i = 0;
-  size_t j = 0;
+  while (residual >= solverDeck->d_tol and
+         iteration < solverDeck->d_maxIters) {
+    auto new_disp = this->newton_step(res);
 
-  for (auto m : mask) {
-    if (m == true) {
-      new_disp[i] = x[j];
-      j += 1;
-    }
-    i += 1;
+    double alpha = line_search(new_disp, res);
+
+    // the quasi-Newton updates need the step actually taken
+    d_prevStep *= alpha;
+
+    residual = util::l2Norm(res);
+    iteration++;
+
+    std::cout << "It: " << iteration << " Res: " << residual << std::endl;
+
+    if (!std::isfinite(residual)) return false;
   }
 
-  return new_disp;
+  return residual < solverDeck->d_tol;
 }
 
 template <class T>
 void model::QuasiStaticModel<T>::solver() {
-  size_t dim = d_dataManager_p->getModelDeckP()->d_dim;
+  const auto *solverDeck = d_input_p->getSolverDeck();
+  const auto *modelDeck = d_input_p->getModelDeck();
+
   d_n = 1;
   d_time = 0;
 
-  double delta_t = d_dataManager_p->getModelDeckP()->d_dt;
+  double delta_t = modelDeck->d_dt;
+  double minDt = solverDeck->d_minStepFactor * modelDeck->d_dt;
+  double maxDt = solverDeck->d_maxStepFactor * modelDeck->d_dt;
+  bool adaptive = solverDeck->d_adaptiveLoad;
 
-  // Write the initial data
-  model::Output(d_input_p, d_dataManager_p, d_n - 1, d_time);
+  std::vector<util::Point3> backupDisplacement(d_nnodes, util::Point3());
+  std::vector<util::Point3> backupVelocity(d_nnodes, util::Point3());
 
-  for (; d_n < d_input_p->getModelDeck()->d_Nt + 1; d_n++) {
-    d_time = d_n * delta_t;
+  d_dynamic = modelDeck->d_timeDiscretization == "newmark" or
+              modelDeck->d_timeDiscretization == "hht_alpha";
+  if (d_dynamic) init_dynamics();
 
-    double residual = std::numeric_limits<double>::max();
+  // Write the initial data
+  model::Output(d_input_p, d_dataManager_p, d_n - 1, d_time);
 
-    // Apply the force loading
-    d_dataManager_p->getForceLoadingP()->apply(
-        d_time, d_dataManager_p->getBodyForceP(), d_dataManager_p->getMeshP());
+  while (adaptive ? util::compare::definitelyLessThan(d_time,
+                                                      modelDeck->d_tFinal)
+                  : d_n < modelDeck->d_Nt + 1) {
+    double time = d_time;
 
-    // Apply the displacement loading
-    d_dataManager_p->getDisplacementLoadingP()->apply(
-        d_time, d_dataManager_p->getDisplacementP(),
-        d_dataManager_p->getVelocityP(), d_dataManager_p->getMeshP());
+    if (adaptive) {
+      d_time = std::min(d_time + delta_t, modelDeck->d_tFinal);
 
-    auto res = this->computeResidual();
+      // the load step is repeated if it fails
+      util::parallel::copy(*d_dataManager_p->getDisplacementP(),
+                           backupDisplacement);
+      util::parallel::copy(*d_dataManager_p->getVelocityP(), backupVelocity);
+    } else
+      d_time = d_n * delta_t;
 
     size_t iteration = 0;
+    bool converged = solve_load_step(iteration);
+
+    if (adaptive and !converged) {
+      // cut back the load increment and repeat the load step
+      util::parallel::copy(backupDisplacement,
+                           *d_dataManager_p->getDisplacementP());
+      util::parallel::copy(backupVelocity, *d_dataManager_p->getVelocityP());
+      d_time = time;
+      delta_t *= solverDeck->d_cutbackFactor;
+
+      std::cout << d_name << ": Load step did not converge, reducing the load "
+                << "increment to " << delta_t << std::endl;
+
+      if (util::compare::definitelyLessThan(delta_t, minDt)) {
+        std::cerr << "Error: Load increment " << delta_t
+                  << " is below the minimal load increment " << minDt
+                  << " at time " << d_time << ".\n";
+        exit(1);
+      }
 
-    residual = util::l2Norm(res);
-
-    std::cout << "It: " << iteration << " Res: " << residual << std::endl;
-
-    while (residual >= d_input_p->getSolverDeck()->d_tol and
-           iteration < d_input_p->getSolverDeck()->d_maxIters) {
-      auto new_disp = this->newton_step(res);
-
-      hpx::experimental::for_loop(
-          hpx::execution::par, 0, d_nnodes, [&](boost::uint64_t i) {
-            size_t id = i * dim;
-
-            (*d_dataManager_p->getDisplacementP())[i].d_x =
-                (*d_dataManager_p->getDisplacementP())[i].d_x + new_disp[id];
-            if (dim >= 2)
-              (*d_dataManager_p->getDisplacementP())[i].d_y =
-                  (*d_dataManager_p->getDisplacementP())[i].d_y +
-                  new_disp[id + 1];
-            if (dim == 3)
-              (*d_dataManager_p->getDisplacementP())[i].d_z =
-                  (*d_dataManager_p->getDisplacementP())[i].d_z +
-                  new_disp[id + 2];
-          });
-
-      this->computeForces();
+      continue;
+    }
 
-      res = this->computeResidual();
+    // increase the load increment after fast convergence
+    if (adaptive and iteration <= solverDeck->d_fastIterations)
+      delta_t = std::min(delta_t * solverDeck->d_growthFactor, maxDt);
 
-      residual = util::l2Norm(res);
-      iteration++;
+    d_iterations.push_back(iteration);
 
-      std::cout << "It: " << iteration << " Res: " << residual << std::endl;
-    }
+    if (d_dynamic) update_dynamics();
 
     this->computeForces(true);
 
+    if (d_dynamic) compute_energy();
+
     // Do the output after one successful iteration
     model::Output(d_input_p, d_dataManager_p, d_n, d_time);
+
+    d_n++;
   }
+
+  size_t iterations = 0;
+  for (const auto &it : d_iterations) iterations += it;
+  std::cout << d_name << ": Jacobian assemblies = " << d_numAssemblies
+            << ", Newton iterations = " << iterations
+            << ", load steps = " << d_iterations.size() << std::endl;
 }
 
 template <class T>
 util::VectorXi model::QuasiStaticModel<T>::computeResidual() {
   size_t dim = d_dataManager_p->getModelDeckP()->d_dim;
-  util::VectorXi res = util::VectorXi(d_nnodes * dim, 0.);
+  util::VectorXi res = util::VectorXi(d_nFreeDofs, 0.);
 
-  auto bcN = d_dataManager_p->getDisplacementLoadingP()->d_bcNodes;
-  auto bcD = d_dataManager_p->getDisplacementLoadingP()->d_bcData;
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, d_nnodes, [&](boost::uint64_t i) {
+        for (size_t r = 0; r < dim; r++) {
+          long int id = d_dofMap[i * dim + r];
 
-  for (size_t i = 0; i < d_nnodes; i++) {
-    std::vector<size_t> dimensions(dim);
-    std::iota(std::begin(dimensions), std::end(dimensions), 0);
+          if (id != -1)
+            res[id] = (*d_dataManager_p->getForceP())[i][r] +
+                      (*d_dataManager_p->getBodyForceP())[i][r];
+        }
 
-    size_t k = 0;
-    for (auto bc : bcD) {
-      auto direction = bc.d_direction;
+        if (d_dynamic) {
+          double alpha = d_dataManager_p->getModelDeckP()->d_hhtAlpha;
+          auto a = getAcceleration(i);
 
-      for (auto d : direction) {
-        for (auto n : bcN[k])
+          for (size_t r = 0; r < dim; r++) {
+            long int id = d_dofMap[i * dim + r];
 
-          if (std::find(bcN[k].begin(), bcN[k].end(), i) != bcN[k].end()) {
-            dimensions[d - 1] = std::numeric_limits<std::size_t>::max();
+            if (id != -1)
+              res[id] = (1. + alpha) * res[id] - alpha * d_fOld[i][r] -
+                        d_material_p->getDensity() * a[r];
           }
-      }
-      k++;
-    }
-
-    size_t id = i * dim;
-
-    for (auto e : dimensions) {
-      switch (e) {
-        case 0:
-          res[id] = (*d_dataManager_p->getForceP())[i][0] +
-                    (*d_dataManager_p->getBodyForceP())[i][0];
-          break;
-        case 1:
-          res[id + 1] = (*d_dataManager_p->getForceP())[i][1] +
-                        (*d_dataManager_p->getBodyForceP())[i][1];
-          break;
-        case 2:
-          res[id + 2] = (*d_dataManager_p->getForceP())[i][2] +
-                        (*d_dataManager_p->getBodyForceP())[i][2];
-          break;
-        default:
-          break;
-      }
-    }
-  }
+        }
+      });
 
   return res;
 }
 
+template <class T>
+void model::QuasiStaticModel<T>::init_dynamics() {
+  d_timeOld = d_time;
+
+  // apply the loading of the initial time
+  util::parallel::fill(*d_dataManager_p->getBodyForceP(), util::Point3());
+  d_dataManager_p->getForceLoadingP()->apply(
+      d_time, d_dataManager_p->getBodyForceP(), d_dataManager_p->getMeshP());
+  d_dataManager_p->getDisplacementLoadingP()->apply(
+      d_time, d_dataManager_p->getDisplacementP(),
+      d_dataManager_p->getVelocityP(), d_dataManager_p->getMeshP());
+
+  this->computeForces();
+
+  d_uOld = *d_dataManager_p->getDisplacementP();
+  d_vOld = *d_dataManager_p->getVelocityP();
+  d_fOld = std::vector<util::Point3>(d_nnodes, util::Point3());
+  d_aOld = std::vector<util::Point3>(d_nnodes, util::Point3());
+  d_bOld = *d_dataManager_p->getBodyForceP();
+  d_work = 0.;
+  d_energy.clear();
+
+  // initial acceleration from the equation of motion
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, d_nnodes, [&](boost::uint64_t i) {
+        d_fOld[i] = (*d_dataManager_p->getForceP())[i] +
+                    (*d_dataManager_p->getBodyForceP())[i];
+        d_aOld[i] = d_fOld[i] / d_material_p->getDensity();
+      });
+}
+
+template <class T>
+void model::QuasiStaticModel<T>::predict_dynamics() {
+  size_t dim = d_dataManager_p->getModelDeckP()->d_dim;
+  auto &u = *d_dataManager_p->getDisplacementP();
+
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, d_nnodes, [&](boost::uint64_t i) {
+        for (size_t r = 0; r < dim; r++)
+          if (d_dofMap[i * dim + r] != -1)
+            u[i][r] = d_uOld[i][r] + d_dtStep * d_vOld[i][r] +
+                      0.5 * d_dtStep * d_dtStep * d_aOld[i][r];
+      });
+}
+
+template <class T>
+util::Point3 model::QuasiStaticModel<T>::getAcceleration(size_t i) const {
+  double beta = d_dataManager_p->getModelDeckP()->d_newmarkBeta;
+
+  return ((*d_dataManager_p->getDisplacementP())[i] - d_uOld[i] -
+          d_dtStep * d_vOld[i]) /
+             (beta * d_dtStep * d_dtStep) -
+         ((1. - 2. * beta) / (2. * beta)) * d_aOld[i];
+}
+
+template <class T>
+void model::QuasiStaticModel<T>::update_dynamics() {
+  double gamma = d_dataManager_p->getModelDeckP()->d_newmarkGamma;
+  auto &u = *d_dataManager_p->getDisplacementP();
+  auto &v = *d_dataManager_p->getVelocityP();
+  const auto &b = *d_dataManager_p->getBodyForceP();
+  const auto *mesh = d_dataManager_p->getMeshP();
+  std::vector<double> work(d_nnodes, 0.);
+
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, d_nnodes, [&](boost::uint64_t i) {
+        auto a = getAcceleration(i);
+
+        // trapezoidal rule for the work of the external force
+        work[i] = 0.5 * (d_bOld[i] + b[i]).dot(u[i] - d_uOld[i]) *
+                  mesh->getNodalVolume(i);
+
+        v[i] = d_vOld[i] + d_dtStep * ((1. - gamma) * d_aOld[i] + gamma * a);
+
+        d_uOld[i] = u[i];
+        d_vOld[i] = v[i];
+        d_aOld[i] = a;
+        d_fOld[i] = (*d_dataManager_p->getForceP())[i] + b[i];
+        d_bOld[i] = b[i];
+      });
+
+  d_work += util::methods::add(work);
+  d_timeOld = d_time;
+}
+
+template <class T>
+void model::QuasiStaticModel<T>::compute_energy() {
+  // strain energy is only computed for the output
+  if (!d_dataManager_p->getOutputDeckP()->isTagInOutput("Strain_Energy"))
+    return;
+
+  const auto &v = *d_dataManager_p->getVelocityP();
+  const auto &strain = *d_dataManager_p->getStrainEnergyP();
+  const auto *mesh = d_dataManager_p->getMeshP();
+  double rho = d_material_p->getDensity();
+  std::vector<double> kinetic(d_nnodes, 0.);
+  std::vector<double> potential(d_nnodes, 0.);
+
+  hpx::experimental::for_loop(
+      hpx::execution::par, 0, d_nnodes, [&](boost::uint64_t i) {
+        auto vol = mesh->getNodalVolume(i);
+        kinetic[i] = 0.5 * rho * v[i].dot(v[i]) * vol;
+        potential[i] = double(strain[i]) * vol;
+      });
+
+  double ek = util::methods::add(kinetic);
+  double es = util::methods::add(potential);
+  d_energy.emplace_back(ek, ek + es - d_work);
+
+  std::cout << d_name << ": Kinetic energy = " << ek
+            << ", strain energy = " << es << ", external work = " << d_work
+            << std::endl;
+}
+
+template <class T>
+const std::vector<std::pair<double, double>>
+    &model::QuasiStaticModel<T>::getEnergy() const {
+  return d_energy;
+}
+
+template <class T>
+size_t model::QuasiStaticModel<T>::getNumAssemblies() const {
+  return d_numAssemblies;
+}
+
+template <class T>
+const std::vector<size_t> &model::QuasiStaticModel<T>::getIterations() const {
+  return d_iterations;
+}
+
 template class model::QuasiStaticModel<material::pd::ElasticState>;
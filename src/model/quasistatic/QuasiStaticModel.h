@@ -10,6 +10,7 @@
 #define MODEL_QSMODEL_H
 
 #include <hpx/config.hpp>
+#include <utility>
 #include "model/model.h"
 #include "inp/decks/modelDeck.h"
 
@@ -51,6 +52,7 @@ class BaseMaterial;
 
 namespace util {
 class StateBasedHelperFunctions;
+class GeometricMultigrid;
 } // namespace util
 
 namespace data {
@@ -95,12 +97,50 @@ public:
 
 	/*! @brief Constructor
 	 *  @param deck Pointer to the input deck
+	 *  @param solve If false, the model is only initialized and not solved
 	 */
-	QuasiStaticModel(inp::Input *deck);
+	QuasiStaticModel(inp::Input *deck, bool solve = true);
 
 	/*! @brief Destructor */
 	~QuasiStaticModel();
 
+	/*!
+	 * @brief Times the force assembly for a smooth displacement field
+	 *
+	 * The lock-free assembly is compared with the reference assembly which
+	 * scatters the reaction forces under a global mutex. The program exits
+	 * with an error if the forces of both differ by more than round-off.
+	 *
+	 * @param repeat Number of timed force computations
+	 * @return Pair of time per force computation in seconds of the lock-free
+	 * and the mutex assembly
+	 */
+	std::pair<double, double> timeForces(size_t repeat);
+
+	/*!
+	 * @brief Returns the energy after each time step of the implicit dynamic
+	 * schemes
+	 *
+	 * The energy is only recorded if Strain_Energy is an output tag.
+	 *
+	 * @return Vector of pairs of kinetic energy and total energy, i.e.
+	 * kinetic plus strain energy minus the work of the external force
+	 */
+	const std::vector<std::pair<double, double>> &getEnergy() const;
+
+	/*!
+	 * @brief Returns the number of Jacobian assemblies of the simulation
+	 * @return Number of assemblies
+	 */
+	size_t getNumAssemblies() const;
+
+	/*!
+	 * @brief Returns the number of Newton iterations of each converged load
+	 * step
+	 * @return Vector of iterations
+	 */
+	const std::vector<size_t> &getIterations() const;
+
 private:
 
 	/*!
@@ -108,6 +148,42 @@ private:
 	 */
 	void initHObjects();
 
+	/*!
+	 * @brief Builds the lists of incoming bonds and the bond force storage
+	 * used by the lock-free force assembly
+	 */
+	void initBondLists();
+
+	/*!
+	 * @brief Computes the forces of all nodes without locking
+	 *
+	 * In a first sweep, each node computes and stores the forces of its own
+	 * bonds. In a second sweep, each node gathers the reaction forces of the
+	 * bonds pointing to it.
+	 *
+	 * @param material The material object
+	 * @param dataManager Data manager holding the displacement and force
+	 * @param bondForces Storage for the bond forces
+	 * @param full If true the Strain and Stress tensors are computed
+	 */
+	void assembleForces(material::pd::BaseMaterial *material,
+			data::DataManager *dataManager,
+			std::vector<std::vector<util::Point3>> &bondForces,
+			bool full = false);
+
+	/*!
+	 * @brief Computes the forces of all nodes by scattering the reaction
+	 * forces under a global mutex
+	 *
+	 * This was the assembly before the lock-free assembly and is only kept
+	 * as reference for timeForces().
+	 *
+	 * @param material The material object
+	 * @param dataManager Data manager holding the displacement and force
+	 */
+	void assembleForcesLocked(material::pd::BaseMaterial *material,
+			data::DataManager *dataManager);
+
 	/*!
 	 * @brief Computes the forces of all nodes
 	 * @param full If true the Strain and Stress tensors are computed
@@ -132,51 +208,153 @@ private:
 	void assembly_jacobian_matrix_part(size_t begin, size_t end, size_t thread);
 
 	/*! @brief Computes the new displacement of Newton step
+	 *
+	 * Depending on the Newton type in the solver deck, the Jacobian is
+	 * assembled in every iteration or a factorized Jacobian is reused and
+	 * optionally corrected by BFGS or Broyden updates.
+	 *
 	 * @param res Residual vector
 	 * @return The updated displacement
 	 */
-	util::VectorXi newton_step(util::VectorXi &res);
+	util::VectorXi newton_step(const util::VectorXi &res);
+
+	/*!
+	 * @brief Assembles and factorizes the Jacobian matrix
+	 */
+	void factorize_jacobian();
+
+	/*!
+	 * @brief Solves with the factorized Jacobian matrix
+	 * @param v Right hand side
+	 * @param trans If true, solve with the transposed Jacobian
+	 * @return Solution
+	 */
+	util::VectorXi solve_factorized(const util::VectorXi &v, bool trans = false);
+
+	/*!
+	 * @brief Applies the limited-memory Broyden approximation of the inverse
+	 * Jacobian
+	 * @param v Vector
+	 * @param trans If true, apply the transposed approximation
+	 * @return Product of the approximation and v
+	 */
+	util::VectorXi apply_broyden(const util::VectorXi &v, bool trans = false);
+
+	/*!
+	 * @brief Computes the limited-memory BFGS step using the two-loop
+	 * recursion with the factorized Jacobian as initial approximation
+	 * @param res Residual vector
+	 * @return Newton step
+	 */
+	util::VectorXi bfgs_step(const util::VectorXi &res);
+
+	/*!
+	 * @brief Clears the history of the quasi-Newton updates at the beginning
+	 * of a load step
+	 */
+	void reset_newton();
+
+	/*!
+	 * @brief Adds a scaled Newton step to the displacement
+	 * @param du Newton step for all DOFs
+	 * @param scale Scaling factor
+	 */
+	void add_displacement(const util::VectorXi &du, double scale);
+
+	/*!
+	 * @brief Applies the Newton step with a backtracking line search on the
+	 * norm of the residual
+	 * @param new_disp Newton step for all DOFs
+	 * @param res Residual vector, updated to the residual after the step
+	 * @return The step length
+	 */
+	double line_search(const util::VectorXi &new_disp, util::VectorXi &res);
+
+	/*!
+	 * @brief Applies the loading at the current time and solves for the
+	 * equilibrium
+	 * @param iteration Number of Newton iterations needed
+	 * @return True if the Newton method converged
+	 */
+	bool solve_load_step(size_t &iteration);
 
 	/*!
 	 * @brief Starts the simulation and controls the solver
+	 *
+	 * With adaptive load stepping, the load increment grows after fast
+	 * convergence and a failed load step is repeated with a smaller load
+	 * increment.
 	 */
 	void solver();
 
 	/*!
 	 * @brief Computes the residual for the Newton step
+	 *
+	 * For the implicit dynamic schemes the residual is
+	 * \f[ R = (1 + \alpha) F_{n+1} - \alpha F_n - \rho a_{n+1}, \f]
+	 * where F is the sum of internal and external force and \f$ \alpha = 0
+	 * \f$ for Newmark.
+	 *
 	 * @return The residual vector
 	 */
 	util::VectorXi computeResidual();
 
 	/**
-	 * @name Functions to manipulate the tangent stiffness matrix
-	 *
+	 * @name Implicit dynamics
 	 */
 	/**@{*/
 
 	/*!
-	 * @brief Removes the i-th row of a matrix
-	 * @param matrix The matrix
-	 * @param rowToRemove Id of the row to remove
+	 * @brief Initializes displacement, velocity, acceleration, and force of
+	 * the first time step
+	 */
+	void init_dynamics();
+
+	/*!
+	 * @brief Predicts the displacement of free DOFs at the new time step
+	 * \f$ u_{n+1} = u_n + \Delta t v_n + \frac{\Delta t^2}{2} a_n \f$
 	 */
-	void removeRow(util::Matrixij &matrix, size_t rowToRemove);
+	void predict_dynamics();
 
 	/*!
-	 * @brief Removes the i-th column of a matrix
-	 * @param matrix The matrix
-	 * @param colToRemove Id of the column to remove
+	 * @brief Returns the Newmark acceleration of node i for the current
+	 * displacement
+	 *
+	 * \f[ a_{n+1} = \frac{u_{n+1} - u_n - \Delta t v_n}{\beta \Delta t^2} -
+	 * \frac{1 - 2\beta}{2\beta} a_n \f]
+	 *
+	 * @param i Id of node
+	 * @return Acceleration
 	 */
-	void removeCol(util::Matrixij &matrix, size_t colToRemove);
+	util::Point3 getAcceleration(size_t i) const;
 
 	/*!
-	 * @brief Removes the i-th row of a vector
-	 * @param vector The vector
-	 * @param rowToRemove Id of the row to remove
+	 * @brief Stores the converged state of the time step and updates the
+	 * velocity \f$ v_{n+1} = v_n + \Delta t ((1 - \gamma) a_n + \gamma
+	 * a_{n+1}) \f$
 	 */
-	void removeRow(util::VectorXi &vector, size_t rowToRemove);
+	void update_dynamics();
+
+	/*!
+	 * @brief Records kinetic and total energy of the converged time step
+	 *
+	 * The work of the external force is integrated with the trapezoidal rule
+	 * in update_dynamics(), so that for Newmark with \f$ \beta = 1/4, \gamma
+	 * = 1/2 \f$ the total energy of a linear problem is conserved.
+	 */
+	void compute_energy();
 
 	/** @}*/
 
+	/*!
+	 * @brief Builds the map from global DOFs to free (unconstrained) DOFs
+	 *
+	 * The map is built once from the displacement boundary conditions and is
+	 * used by the assembly, the residual, and the solution scatter to work in
+	 * reduced numbering directly.
+	 */
+	void initDofMap();
+
 	/*! @brief Number of nodes */
 	size_t d_nnodes;
 
@@ -189,12 +367,102 @@ private:
 	/*! @brief Number of available os threads */
 	size_t d_osThreads;
 
+	/*! @brief Map from global DOF (node * dim + direction) to free DOF id,
+	 * -1 if the DOF is constrained by a displacement boundary condition */
+	std::vector<long int> d_dofMap;
+
+	/*! @brief Number of free DOFs */
+	size_t d_nFreeDofs;
+
+	/*! @brief Flag indicating an implicit dynamic scheme */
+	bool d_dynamic;
+
+	/*! @brief Time step of the current step of the dynamic scheme */
+	double d_dtStep;
+
+	/*! @brief Time step for which the Jacobian was factorized */
+	double d_dtFactorized;
+
+	/*! @brief Time of the last converged step */
+	double d_timeOld;
+
+	/*! @brief Displacement of the last converged step */
+	std::vector<util::Point3> d_uOld;
+
+	/*! @brief Velocity of the last converged step */
+	std::vector<util::Point3> d_vOld;
+
+	/*! @brief Acceleration of the last converged step */
+	std::vector<util::Point3> d_aOld;
+
+	/*! @brief Total force of the last converged step */
+	std::vector<util::Point3> d_fOld;
+
+	/*! @brief External force of the last converged step */
+	std::vector<util::Point3> d_bOld;
+
+	/*! @brief Work of the external force up to the last converged step */
+	double d_work;
+
+	/*! @brief Kinetic and total energy after each time step */
+	std::vector<std::pair<double, double>> d_energy;
+
+	/*! @brief Bonds (i, local id of j in the neighbor list of i) pointing to
+	 * node j */
+	std::vector<std::vector<std::pair<size_t, size_t>>> d_incomingBonds;
+
+	/*! @brief Bond forces aligned with the neighbor list */
+	std::vector<std::vector<util::Point3>> d_bondForces;
+
+	/*! @brief Bond forces of the perturbed force computations, one per os
+	 * thread */
+	std::vector<std::vector<std::vector<util::Point3>>> d_threadBondForces;
+
 	/*! Jacobian matrix */
 	util::Matrixij jacobian;
 
+	/*! @brief Multigrid preconditioner of the Krylov solver, nullptr if not
+	 * used */
+	util::GeometricMultigrid *d_multigrid_p;
+
+	/*! @brief LU factorization of the Jacobian matrix */
+	util::ColMatrixij d_jacobianLU;
+
+	/*! @brief Pivots of the LU factorization */
+	std::vector<int> d_pivots;
+
+	/*! @brief Flag indicating that the LU factorization is valid */
+	bool d_hasFactorization;
+
+	/*! @brief Number of Newton iterations since the last factorization */
+	size_t d_itSinceRefresh;
+
+	/*! @brief Number of Jacobian assemblies */
+	size_t d_numAssemblies;
+
+	/*! @brief Newton iterations of each converged load step */
+	std::vector<size_t> d_iterations;
+
+	/*! @brief Residual of the previous Newton iteration */
+	util::VectorXi d_prevRes;
+
+	/*! @brief Step of the previous Newton iteration */
+	util::VectorXi d_prevStep;
+
+	/*! @brief History of the quasi-Newton updates (steps for BFGS, first
+	 * update vectors for Broyden) */
+	std::vector<util::VectorXi> d_historyS;
+
+	/*! @brief History of the quasi-Newton updates (residual differences for
+	 * BFGS, second update vectors for Broyden) */
+	std::vector<util::VectorXi> d_historyY;
+
 	/*! @brief Data manager objects for the assembly of the stiffness matrix */
 	std::vector<data::DataManager*> d_dataManagers;
 
+	/*! @brief Material objects for the assembly of the stiffness matrix */
+	std::vector<material::pd::BaseMaterial*> d_materials;
+
 	/*! @brief Model deck */
 	inp::ModelDeck *d_modelDeck_p;
 
@@ -1,10 +1,49 @@
 #include "util.h"
 
 #include "util/fastMethods.h"
+#include "util/profiler.h"
 
-model::Output::Output(inp::Input *d_input_p, data::DataManager *d_dataManager_p,
-                      size_t d_n, double d_time) {
+#include <filesystem>
+
+namespace {
+
+/*!
+ * @brief Closes the writer and records the time and size of the file
+ * @param writer Writer
+ * @param filename Filename without extension
+ * @param format Output format
+ */
+void closeWriter(rw::writer::Writer &writer, const std::string &filename,
+                 const std::string &format) {
+  {
+    util::ScopedTimer timer(util::Phase::OutputWrite);
+    writer.close();
+  }
+
+  if (!util::Profiler::isEnabled()) return;
+
+  std::string ext = ".vtu";
+  if (format == "msh")
+    ext = ".msh";
+  else if (format == "legacy_vtk")
+    ext = ".vtk";
+
+  std::error_code ec;
+  auto size = std::filesystem::file_size(filename + ext, ec);
+  if (!ec) util::Profiler::getInstance()->addBytesWritten(size);
+}
+
+/*!
+ * @brief Writes the iteration d_n to the file system
+ * @param d_input_p Pointer to the input deck
+ * @param d_dataManager_p Pointer to the data mamanger
+ * @param d_n Actual iteration
+ * @param d_time Actual simulation time
+ */
+void writeOutput(inp::Input *d_input_p, data::DataManager *d_dataManager_p,
+                 size_t d_n, double d_time) {
   std::cout << "Output: time step = " << d_n << "\n";
+  const auto *outputDeck = d_input_p->getOutputDeck();
 
   // write out % completion of simulation at 10% interval
   {
@@ -28,7 +67,7 @@ model::Output::Output(inp::Input *d_input_p, data::DataManager *d_dataManager_p,
   if (d_n == 0) {
     size_t index = 0;
 
-    if (d_input_p->getOutputDeck()->isTagInOutput("Initial_Crack")) {
+    if (outputDeck->isTagInOutput(inp::OutputTag::Initial_Crack)) {
       for (auto &crack : d_input_p->getFractureDeck()->d_cracks) {
         writer.writeInitialCrack(d_input_p->getOutputDeck()->d_path +
                                      "/initial-crack-" + std::to_string(index) +
@@ -55,15 +94,15 @@ model::Output::Output(inp::Input *d_input_p, data::DataManager *d_dataManager_p,
   // major simulation data
   //
   std::string tag = "Displacement";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag))
+  if (outputDeck->isTagInOutput(inp::OutputTag::Displacement))
     writer.appendPointData(tag, d_dataManager_p->getDisplacementP());
 
   tag = "Velocity";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag))
+  if (outputDeck->isTagInOutput(inp::OutputTag::Velocity))
     writer.appendPointData(tag, d_dataManager_p->getVelocityP());
 
   tag = "Force";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag)) {
+  if (outputDeck->isTagInOutput(inp::OutputTag::Force)) {
     std::vector<util::Point3> force(d_dataManager_p->getMeshP()->getNumNodes(),
                                     util::Point3());
 
@@ -80,21 +119,21 @@ model::Output::Output(inp::Input *d_input_p, data::DataManager *d_dataManager_p,
   // minor simulation data
   //
   if (!d_input_p->getPolicyDeck()->d_enablePostProcessing) {
-    writer.close();
+    closeWriter(writer, filename, d_input_p->getOutputDeck()->d_outFormat);
     return;
   }
 
   tag = "Force_Density";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag))
+  if (outputDeck->isTagInOutput(inp::OutputTag::Force_Density))
     writer.appendPointData(tag, d_dataManager_p->getForceP());
 
   tag = "Reaction_Force";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag)) {
+  if (outputDeck->isTagInOutput(inp::OutputTag::Reaction_Force)) {
     writer.appendPointData(tag, d_dataManager_p->getReactionForceP());
   }
 
   tag = "Total_Reaction_Force";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag)) {
+  if (outputDeck->isTagInOutput(inp::OutputTag::Total_Reaction_Force)) {
     double sum =
         std::accumulate((*d_dataManager_p->getTotalReactionForceP()).begin(),
                         (*d_dataManager_p->getTotalReactionForceP()).end(), 0);
@@ -115,48 +154,48 @@ model::Output::Output(inp::Input *d_input_p, data::DataManager *d_dataManager_p,
   auto d_policy_p = inp::Policy::getInstance(d_input_p->getPolicyDeck());
 
   tag = "Strain_Energy";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag) &&
-      d_policy_p->populateData("Model_d_e"))
+  if (outputDeck->isTagInOutput(inp::OutputTag::Strain_Energy) &&
+      d_policy_p->populateData(inp::PolicyTag::Model_d_e))
     writer.appendPointData(tag, d_dataManager_p->getStrainEnergyP());
 
   tag = "Work_Done";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag) &&
-      d_policy_p->populateData("Model_d_w"))
+  if (outputDeck->isTagInOutput(inp::OutputTag::Work_Done) &&
+      d_policy_p->populateData(inp::PolicyTag::Model_d_w))
     writer.appendPointData(tag, d_dataManager_p->getWorkDoneP());
 
   tag = "Fixity";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag))
+  if (outputDeck->isTagInOutput(inp::OutputTag::Fixity))
     writer.appendPointData(tag, d_dataManager_p->getMeshP()->getFixityP());
 
   tag = "Node_Volume";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag))
+  if (outputDeck->isTagInOutput(inp::OutputTag::Node_Volume))
     writer.appendPointData(tag,
                            d_dataManager_p->getMeshP()->getNodalVolumesP());
 
   tag = "Damage_Phi";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag) &&
-      d_policy_p->populateData("Model_d_phi"))
+  if (outputDeck->isTagInOutput(inp::OutputTag::Damage_Phi) &&
+      d_policy_p->populateData(inp::PolicyTag::Model_d_phi))
     writer.appendPointData(tag, d_dataManager_p->getPhiP());
 
   tag = "Damage_Z";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag) &&
-      d_policy_p->populateData("Model_d_Z"))
+  if (outputDeck->isTagInOutput(inp::OutputTag::Damage_Z) &&
+      d_policy_p->populateData(inp::PolicyTag::Model_d_Z))
     writer.appendPointData(tag, d_dataManager_p->getDamageFunctionP());
 
   tag = "Fracture_Perienergy_Bond";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag) &&
-      d_policy_p->populateData("Model_d_eFB"))
+  if (outputDeck->isTagInOutput(inp::OutputTag::Fracture_Perienergy_Bond) &&
+      d_policy_p->populateData(inp::PolicyTag::Model_d_eFB))
     writer.appendPointData(tag, d_dataManager_p->getBBFractureEnergyP());
 
   tag = "Fracture_Perienergy_Total";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag) &&
-      d_policy_p->populateData("Model_d_eF"))
+  if (outputDeck->isTagInOutput(inp::OutputTag::Fracture_Perienergy_Total) &&
+      d_policy_p->populateData(inp::PolicyTag::Model_d_eF))
     writer.appendPointData(tag, d_dataManager_p->getFractureEnergyP());
 
   tag = "Total_Energy";
 
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag) &&
-      d_policy_p->populateData("Model_d_e")) {
+  if (outputDeck->isTagInOutput(inp::OutputTag::Total_Energy) &&
+      d_policy_p->populateData(inp::PolicyTag::Model_d_e)) {
     double d_te = util::methods::add((*d_dataManager_p->getStrainEnergyP()));
     double d_tw = util::methods::add((*d_dataManager_p->getWorkDoneP()));
     double d_tk = util::methods::add((*d_dataManager_p->getKineticEnergyP()));
@@ -165,25 +204,25 @@ model::Output::Output(inp::Input *d_input_p, data::DataManager *d_dataManager_p,
   }
 
   tag = "Total_Fracture_Perienergy_Bond";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag) &&
-      d_policy_p->populateData("Model_d_eFB")) {
+  if (outputDeck->isTagInOutput(inp::OutputTag::Total_Fracture_Perienergy_Bond) &&
+      d_policy_p->populateData(inp::PolicyTag::Model_d_eFB)) {
     double d_teFB =
         util::methods::add((*d_dataManager_p->getBBFractureEnergyP()));
     writer.appendFieldData(tag, d_teFB);
   }
 
   tag = "Total_Fracture_Perienergy_Total";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag) &&
-      d_policy_p->populateData("Model_d_eF")) {
+  if (outputDeck->isTagInOutput(
+          inp::OutputTag::Total_Fracture_Perienergy_Total) &&
+      d_policy_p->populateData(inp::PolicyTag::Model_d_eF)) {
     double d_teF = util::methods::add((*d_dataManager_p->getFractureEnergyP()));
     writer.appendFieldData(tag, d_teF);
   }
 
   tag = "Neighbors";
-  auto with_crack =
-      d_input_p->getOutputDeck()->isTagInOutput("Neighbors_Crack");
+  auto with_crack = outputDeck->isTagInOutput(inp::OutputTag::Neighbors_Crack);
 
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag) || with_crack) {
+  if (outputDeck->isTagInOutput(inp::OutputTag::Neighbors) || with_crack) {
     tag = "Neighbors_Crack";
 
     std::vector<size_t> amountNeighbors;
@@ -211,7 +250,7 @@ model::Output::Output(inp::Input *d_input_p, data::DataManager *d_dataManager_p,
   }
 
   tag = "Broken_Bonds";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag)) {
+  if (outputDeck->isTagInOutput(inp::OutputTag::Broken_Bonds)) {
     std::vector<size_t> amountNeighbors;
     size_t nodes = d_dataManager_p->getMeshP()->getNumNodes();
 
@@ -232,18 +271,31 @@ model::Output::Output(inp::Input *d_input_p, data::DataManager *d_dataManager_p,
   }
 
   tag = "Strain_Energy";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag))
+  if (outputDeck->isTagInOutput(inp::OutputTag::Strain_Energy))
     writer.appendPointData(tag, d_dataManager_p->getStrainEnergyP());
 
   tag = "Strain_Tensor";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag))
+  if (outputDeck->isTagInOutput(inp::OutputTag::Strain_Tensor))
     writer.appendPointData("Strain_Tensor",
                            d_dataManager_p->getStrainTensorP());
 
   tag = "Stress_Tensor";
-  if (d_input_p->getOutputDeck()->isTagInOutput(tag))
+  if (outputDeck->isTagInOutput(inp::OutputTag::Stress_Tensor))
     writer.appendPointData("Stress_Tensor",
                            d_dataManager_p->getStressTensorP());
 
-  writer.close();
+  closeWriter(writer, filename, d_input_p->getOutputDeck()->d_outFormat);
+}
+
+} // namespace
+
+model::Output::Output(inp::Input *d_input_p, data::DataManager *d_dataManager_p,
+                      size_t d_n, double d_time) {
+  {
+    util::ScopedTimer timer(util::Phase::Output);
+    writeOutput(d_input_p, d_dataManager_p, d_n, d_time);
+  }
+
+  if (util::Profiler::isEnabled())
+    util::Profiler::getInstance()->report(d_n, d_time);
 }
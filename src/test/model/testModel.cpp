@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/hpx_main.hpp>
+
+#include <iostream>
+#include <string>
+
+#include "testModelLib.h"
+
+int main(int argc, char *argv[]) {
+  if (argc < 2) {
+    std::cerr << "Error: Provide the mesh file and optionally the name of "
+                 "the test.\n";
+    return EXIT_FAILURE;
+  }
+
+  // run all tests unless one is selected
+  const std::string name = argc > 2 ? argv[2] : "all";
+  bool found = false;
+
+  //
+  // test coupling of a model with a stand-in external code through memory
+  //
+  if (name == "all" or name == "coupling") {
+    found = true;
+    if (!test::testCoupling(argv[1])) return EXIT_FAILURE;
+  }
+
+  //
+  // test partition of nodes for the distributed model
+  //
+  if (name == "all" or name == "partition") {
+    found = true;
+    if (!test::testPartition(argv[1])) return EXIT_FAILURE;
+  }
+
+  //
+  // test enumeration of bonds without neighbor list
+  //
+  if (name == "all" or name == "celllist") {
+    found = true;
+    if (!test::testCellList(argv[1])) return EXIT_FAILURE;
+  }
+
+  //
+  // test convergence of dynamic relaxation to static equilibrium
+  //
+  if (name == "all" or name == "relaxation") {
+    found = true;
+    if (!test::testDynamicRelaxation(argv[1])) return EXIT_FAILURE;
+  }
+
+  //
+  // test multirate verlet with a single level against velocity verlet
+  //
+  if (name == "all" or name == "multirate") {
+    found = true;
+    if (!test::testMultirate(argv[1])) return EXIT_FAILURE;
+  }
+
+  //
+  // test energy of the implicit dynamic schemes
+  //
+  if (name == "all" or name == "newmark") {
+    found = true;
+    if (!test::testNewmark(argv[1])) return EXIT_FAILURE;
+  }
+
+  //
+  // test reuse of the Jacobian by the Newton methods
+  //
+  if (name == "all" or name == "newton") {
+    found = true;
+    if (!test::testNewton(argv[1])) return EXIT_FAILURE;
+  }
+
+  //
+  // test batch of ensemble members against independent models
+  //
+  if (name == "all" or name == "batch") {
+    found = true;
+    if (!test::testBatch(argv[1])) return EXIT_FAILURE;
+  }
+
+  //
+  // test distributed model against single locality
+  //
+  if (name == "all" or name == "distributed") {
+    found = true;
+    if (!test::testDistributed(argv[1])) return EXIT_FAILURE;
+  }
+
+  if (!found) {
+    std::cerr << "Error: Test " << name << " does not exist.\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
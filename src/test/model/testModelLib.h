@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TEST_MODELLIB_H
+#define TEST_MODELLIB_H
+
+#include <hpx/config.hpp>
+#include <string>
+
+namespace test {
+
+/*!
+ * @brief Perform test on the interface of FDModel for coupled codes
+ *
+ * A stand-in external code prescribes the displacement of the nodes on the
+ * left edge of the mesh through fe::Mesh::getPrescribedValues() and
+ * advances the model one time step at a time. List of tests are as follows:
+ *
+ * 1. After each step the displacement of interface nodes is equal to the
+ * prescribed values.
+ *
+ * 2. The displacement data is not reallocated between steps.
+ *
+ * 3. The prescribed displacement is transferred to the free nodes.
+ *
+ * @param meshFile Filename of the mesh
+ * @return bool True if all tests pass
+ */
+bool testCoupling(const std::string &meshFile);
+
+/*!
+ * @brief Perform test on the partition of nodes of a distributed model
+ *
+ * The nodes of the mesh are decomposed into three partitions. List of tests
+ * are as follows:
+ *
+ * 1. Every node is owned by exactly one partition.
+ *
+ * 2. The nodes sent by a partition to another partition are the ghost nodes
+ * received by the other partition, in the same order.
+ *
+ * 3. All nodes within the horizon of owned nodes are local nodes.
+ *
+ * @param meshFile Filename of the mesh
+ * @return bool True if all tests pass
+ */
+bool testPartition(const std::string &meshFile);
+
+/*!
+ * @brief Perform test on the enumeration of bonds without neighbor list
+ *
+ * List of tests are as follows:
+ *
+ * 1. The neighbors enumerated from geometry::CellList are the neighbors of
+ * geometry::Neighbor.
+ *
+ * 2. geometry::SparseFracture returns the state of bonds which are broken
+ * and restored in arbitrary order.
+ *
+ * 3. The model at memory control level 4 gives the same displacement and
+ * number of broken bonds as the model with neighbor list, without and with
+ * a pre-crack.
+ *
+ * @param meshFile Filename of the mesh
+ * @return bool True if all tests pass
+ */
+bool testCellList(const std::string &meshFile);
+
+/*!
+ * @brief Perform test on dynamic relaxation
+ *
+ * A plate fixed at the left edge and pulled at the right edge is relaxed to
+ * static equilibrium in one load step. The quasi-static model does not
+ * support the RNPBond material of dynamic relaxation, so the static
+ * solution is checked directly. List of tests are as follows:
+ *
+ * 1. The force of free dofs is negligible compared to the reaction force of
+ * fixed dofs.
+ *
+ * 2. The displacement does not depend on the fictitious mass.
+ *
+ * @param meshFile Filename of the mesh
+ * @return bool True if all tests pass
+ */
+bool testDynamicRelaxation(const std::string &meshFile);
+
+/*!
+ * @brief Perform test on multirate verlet scheme
+ *
+ * The plate of the dynamic relaxation test is integrated for 50 steps with
+ * velocity verlet and with multirate verlet restricted to a single time
+ * step level. List of tests are as follows:
+ *
+ * 1. The displacements of both schemes agree.
+ *
+ * 2. The velocities of both schemes agree.
+ *
+ * @param meshFile Filename of the mesh
+ * @return bool True if all tests pass
+ */
+bool testMultirate(const std::string &meshFile);
+
+/*!
+ * @brief Perform test on implicit Newmark and HHT-alpha schemes
+ *
+ * A plate of ElasticState material fixed at the left edge is loaded by a
+ * suddenly applied force at the right edge and vibrates for many periods
+ * with a time step much larger than the stable time step of the explicit
+ * schemes. List of tests are as follows:
+ *
+ * 1. The total energy of Newmark with \f$ \beta = 1/4, \gamma = 1/2 \f$
+ * does not grow.
+ *
+ * 2. The total energy of HHT-alpha does not grow and is dissipated compared
+ * to Newmark.
+ *
+ * @param meshFile Filename of the mesh
+ * @return bool True if all tests pass
+ */
+bool testNewmark(const std::string &meshFile);
+
+/*!
+ * @brief Perform test on the reuse of the Jacobian by the Newton methods
+ *
+ * A plate of ElasticState material fixed at the left edge is stretched by
+ * several percent by a force which increases over five load steps, so that
+ * the tangent changes between load steps. List of tests are as follows:
+ *
+ * 1. Full Newton assembles the Jacobian in every iteration.
+ *
+ * 2. Modified Newton reuses the factorized Jacobian across load steps, i.e.
+ * assembles fewer times than there are load steps, and needs more iterations
+ * than full Newton.
+ *
+ * 3. Modified Newton without reuse across load steps assembles at least once
+ * per load step.
+ *
+ * 4. BFGS and Broyden assemble fewer times than full Newton.
+ *
+ * @param meshFile Filename of the mesh
+ * @return bool True if all tests pass
+ */
+bool testNewton(const std::string &meshFile);
+
+/*!
+ * @brief Perform test on batched ensemble members
+ *
+ * Two members with different elastic modulus pull the plate of the dynamic
+ * relaxation test with velocity verlet. List of tests are as follows:
+ *
+ * 1. The displacement of each member of a batch agrees with the displacement
+ * of an independent model.
+ *
+ * @param meshFile Filename of the mesh
+ * @return bool True if all tests pass
+ */
+bool testBatch(const std::string &meshFile);
+
+/*!
+ * @brief Perform test on distributed model
+ *
+ * The plate of the dynamic relaxation test is pulled with velocity verlet
+ * on all localities and on a single locality. The test is skipped if it
+ * runs on a single locality. List of tests are as follows:
+ *
+ * 1. The displacement of each node in the output of its owning locality
+ * agrees with the single locality run.
+ *
+ * @param meshFile Filename of the mesh
+ * @return bool True if all tests pass
+ */
+bool testDistributed(const std::string &meshFile);
+
+} // namespace test
+
+#endif // TEST_MODELLIB_H
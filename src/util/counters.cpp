@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include "counters.h"
+
+#include <hpx/include/performance_counters.hpp>
+
+#include <functional>
+#include <string>
+
+namespace {
+
+/*!
+ * @brief Returns the value of a monotonically increasing counter since the
+ * last reset
+ * @param value Counter
+ * @param base Value of counter at last reset
+ * @param reset Flag if counter is reset
+ * @return Value Value since last reset
+ */
+std::int64_t getSinceReset(std::uint64_t value,
+                           std::atomic<std::uint64_t> &base, bool reset) {
+  std::uint64_t begin = reset ? base.exchange(value) : base.load();
+  return std::int64_t(value - begin);
+}
+
+/*! @brief Value of counters at last reset */
+std::atomic<std::uint64_t> s_bondsBase(0);
+std::atomic<std::uint64_t> s_forceBase(0);
+std::atomic<std::uint64_t> s_outputBase(0);
+std::atomic<std::uint64_t> s_stepsBase(0);
+
+} // namespace
+
+std::array<std::atomic<std::uint64_t>, size_t(util::Phase::Count)>
+    util::Counters::d_time = {};
+
+std::atomic<std::uint64_t> util::Counters::d_bonds(0);
+
+std::atomic<std::uint64_t> util::Counters::d_brokenBonds(0);
+
+std::atomic<std::uint64_t> util::Counters::d_steps(0);
+
+std::atomic<std::uint64_t> util::Counters::d_bondBytes(0);
+
+void util::Counters::registerCounterTypes() {
+  using hpx::performance_counters::counter_type;
+  using hpx::performance_counters::install_counter_type;
+
+  install_counter_type(
+      "/peridynamics/bonds/evaluated",
+      [](bool reset) {
+        return getSinceReset(d_bonds, s_bondsBase, reset);
+      },
+      "returns the number of bond evaluations", "",
+      counter_type::monotonically_increasing);
+
+  install_counter_type(
+      "/peridynamics/bonds/broken",
+      [](bool) { return std::int64_t(d_brokenBonds); },
+      "returns the number of broken bonds at the last output", "",
+      counter_type::raw);
+
+  install_counter_type(
+      "/peridynamics/time/force",
+      [](bool reset) {
+        return getSinceReset(getTime(Phase::Force), s_forceBase, reset);
+      },
+      "returns the time spent in force computation", "ns",
+      counter_type::monotonically_increasing);
+
+  install_counter_type(
+      "/peridynamics/time/output",
+      [](bool reset) {
+        return getSinceReset(getTime(Phase::Output), s_outputBase, reset);
+      },
+      "returns the time spent in output", "ns",
+      counter_type::monotonically_increasing);
+
+  install_counter_type(
+      "/peridynamics/steps/completed",
+      [](bool reset) {
+        return getSinceReset(d_steps, s_stepsBase, reset);
+      },
+      "returns the number of completed time steps", "",
+      counter_type::monotonically_increasing);
+
+  install_counter_type(
+      "/peridynamics/memory/bond-bytes",
+      [](bool) { return std::int64_t(d_bondBytes); },
+      "returns the memory of neighbor lists and bond states", "bytes",
+      counter_type::raw);
+}
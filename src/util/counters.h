@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UTIL_COUNTERS_H
+#define UTIL_COUNTERS_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace util {
+
+/*! @brief Phases of the simulation timed by util::ScopedTimer
+ *
+ * Times are inclusive, i.e. Integration contains the Loading and Force
+ * phases of the time steps and Output contains OutputWrite.
+ */
+enum class Phase : size_t {
+  MeshRead = 0,
+  NeighborBuild,
+  FractureInit,
+  MaterialInit,
+  Loading,
+  Force,
+  Integration,
+  PostProcessing,
+  Output,
+  OutputWrite,
+  Count
+};
+
+/*! @brief Application specific HPX performance counters
+ *
+ * The solver progress is collected in static counters, which are always
+ * updated since this costs one atomic add per phase or force computation.
+ * util::Profiler writes them to its report, and they are exposed as HPX
+ * performance counters of type
+ *
+ * - `/peridynamics/bonds/evaluated` Number of bond evaluations
+ * - `/peridynamics/bonds/broken` Number of broken bonds at the last output
+ * - `/peridynamics/time/force` Time spent in force computation in ns
+ * - `/peridynamics/time/output` Time spent in output in ns
+ * - `/peridynamics/steps/completed` Number of time steps completed
+ * - `/peridynamics/memory/bond-bytes` Bytes of neighbor lists and bond
+ * states
+ *
+ * so that they can be queried together with the counters of HPX, e.g. with
+ * `--hpx:print-counter=/peridynamics{locality#0/total}/bonds/evaluated`.
+ * The counters are static so that they can be read by the runtime after
+ * the model is destroyed. Each model reports its own broken bonds, steps,
+ * and bytes as the change to the value it reported before, so that the
+ * counters are the sum over all models of the process, e.g. the members of
+ * an ensemble.
+ */
+class Counters {
+
+public:
+  /*!
+   * @brief Installs the counter types with HPX
+   *
+   * Has to be registered as startup function of HPX so that the counters
+   * are known when the counters given on command line are created.
+   */
+  static void registerCounterTypes();
+
+  /*!
+   * @brief Adds the time spent in a phase
+   * @param phase Phase
+   * @param ns Time in nano seconds
+   */
+  static void addTime(Phase phase, std::uint64_t ns) {
+    d_time[size_t(phase)] += ns;
+  }
+
+  /*!
+   * @brief Adds number of bond evaluations
+   * @param n Number of bonds evaluated
+   */
+  static void addBondEvaluations(std::uint64_t n) { d_bonds += n; }
+
+  /*!
+   * @brief Replaces the number of broken bonds of a model
+   * @param old Number of broken bonds of the model reported before
+   * @param n Number of broken bonds of the model
+   */
+  static void updateBrokenBonds(std::uint64_t old, std::uint64_t n) {
+    d_brokenBonds += n - old;
+  }
+
+  /*!
+   * @brief Replaces the number of completed time steps of a model
+   * @param old Number of time steps of the model reported before
+   * @param n Number of time steps of the model
+   */
+  static void updateSteps(std::uint64_t old, std::uint64_t n) {
+    d_steps += n - old;
+  }
+
+  /*!
+   * @brief Replaces the memory of neighbor lists and bond states of a model
+   * @param old Number of bytes of the model reported before
+   * @param n Number of bytes of the model
+   */
+  static void updateBondBytes(std::uint64_t old, std::uint64_t n) {
+    d_bondBytes += n - old;
+  }
+
+  /*!
+   * @brief Returns the time spent in a phase
+   * @param phase Phase
+   * @return Time Time in nano seconds
+   */
+  static std::uint64_t getTime(Phase phase) { return d_time[size_t(phase)]; }
+
+  /*!
+   * @brief Returns the number of bond evaluations
+   * @return N Number of bonds evaluated
+   */
+  static std::uint64_t getBondEvaluations() { return d_bonds; }
+
+private:
+  /*! @brief Time spent in phases in nano seconds */
+  static std::array<std::atomic<std::uint64_t>, size_t(Phase::Count)> d_time;
+
+  /*! @brief Number of bond evaluations */
+  static std::atomic<std::uint64_t> d_bonds;
+
+  /*! @brief Number of broken bonds */
+  static std::atomic<std::uint64_t> d_brokenBonds;
+
+  /*! @brief Number of completed time steps */
+  static std::atomic<std::uint64_t> d_steps;
+
+  /*! @brief Bytes of neighbor lists and bond states */
+  static std::atomic<std::uint64_t> d_bondBytes;
+};
+
+} // namespace util
+
+#endif // UTIL_COUNTERS_H
@@ -17,6 +17,8 @@ namespace util {
 typedef blaze::DynamicVector<double, blaze::columnVector> VectorXi;
 /*! @brief Blaze: Definition of n x m matrix */
 typedef blaze::DynamicMatrix<double> Matrixij;
+/*! @brief Blaze: Definition of n x m column-major matrix (LAPACK layout) */
+typedef blaze::DynamicMatrix<double, blaze::columnMajor> ColMatrixij;
 /*! @brief Blaze: Definition of n x n symmetric matrix */
 typedef blaze::SymmetricMatrix<blaze::DynamicMatrix<double>> SymMatrixij;
 /*! @brief Blaze: Definition of 3 x 3 matrix */
@@ -0,0 +1,254 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include "multigrid.h"
+
+#include <hpx/include/parallel_algorithm.hpp>
+
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <map>
+
+util::GeometricMultigrid::GeometricMultigrid(
+    const std::vector<util::Point3> &nodes, const std::vector<double> &volumes,
+    const std::vector<long int> &dofMap, size_t dim, double h,
+    size_t maxLevels, size_t coarseSize, size_t smoothingSteps)
+    : d_A0_p(nullptr), d_smoothingSteps(smoothingSteps) {
+  // points of the finest level, one per free DOF
+  size_t nfree = 0;
+  for (auto id : dofMap)
+    if (id != -1) nfree++;
+
+  std::vector<util::Point3> pos(nfree);
+  std::vector<double> vol(nfree, 0.);
+  std::vector<size_t> dir(nfree, 0);
+
+  auto xmin = nodes.empty() ? util::Point3() : nodes[0];
+  for (size_t n = 0; n < nodes.size(); n++) {
+    for (size_t r = 0; r < 3; r++) xmin[r] = std::min(xmin[r], nodes[n][r]);
+
+    for (size_t r = 0; r < dim; r++) {
+      auto id = dofMap[n * dim + r];
+      if (id == -1) continue;
+
+      pos[id] = nodes[n];
+      vol[id] = volumes[n];
+      dir[id] = r;
+    }
+  }
+
+  // aggregate the points of a level over cells of twice the size
+  double cell = h;
+  while (getNumLevels() < maxLevels and pos.size() > coarseSize) {
+    cell *= 2.;
+
+    std::map<std::array<long int, 4>, size_t> ids;
+    std::vector<size_t> cid(pos.size(), 0);
+    for (size_t k = 0; k < pos.size(); k++) {
+      std::array<long int, 4> key = {
+          (long int)std::floor((pos[k].d_x - xmin.d_x) / cell),
+          (long int)std::floor((pos[k].d_y - xmin.d_y) / cell),
+          (long int)std::floor((pos[k].d_z - xmin.d_z) / cell),
+          (long int)dir[k]};
+      cid[k] = ids.emplace(key, ids.size()).first->second;
+    }
+
+    size_t nc = ids.size();
+
+    // coarsen further before adding a level if the reduction is too small
+    if (double(nc) > 0.9 * double(pos.size())) {
+      if (nc <= dim) break;
+      continue;
+    }
+
+    std::vector<util::Point3> cpos(nc);
+    std::vector<double> cvol(nc, 0.);
+    std::vector<size_t> cdir(nc, 0);
+    std::vector<std::vector<size_t>> members(nc);
+
+    for (size_t k = 0; k < pos.size(); k++) {
+      auto c = cid[k];
+      cpos[c] += vol[k] * pos[k];
+      cvol[c] += vol[k];
+      cdir[c] = dir[k];
+      members[c].push_back(k);
+    }
+
+    for (size_t c = 0; c < nc; c++) cpos[c] = cpos[c] / cvol[c];
+
+    d_coarseId.push_back(cid);
+    d_members.push_back(members);
+
+    pos = cpos;
+    vol = cvol;
+    dir = cdir;
+  }
+
+  std::cout << "Multigrid: Number of levels = " << getNumLevels()
+            << ", DOFs of coarsest level = " << pos.size() << std::endl;
+}
+
+void util::GeometricMultigrid::setup(const util::Matrixij &A) {
+  d_A0_p = &A;
+
+  size_t nlevels = getNumLevels();
+  d_operators.resize(nlevels - 1);
+  d_invDiag.resize(nlevels);
+
+  // Galerkin coarse operators A_{l+1} = P_l^T A_l P_l, which are symmetric
+  // if A_l is symmetric
+  for (size_t l = 0; l + 1 < nlevels; l++) {
+    const auto &Af = getOperator(l);
+    const auto &members = d_members[l];
+    const auto &cid = d_coarseId[l];
+    size_t nf = Af.rows();
+    size_t nc = members.size();
+
+    util::Matrixij B(nc, nf, 0.);
+    util::Matrixij Ac(nc, nc, 0.);
+
+    hpx::experimental::for_loop(
+        hpx::execution::par, 0, nc, [&](boost::uint64_t c) {
+          for (auto k : members[c]) blaze::row(B, c) += blaze::row(Af, k);
+
+          for (size_t j = 0; j < nf; j++) Ac(c, cid[j]) += B(c, j);
+        });
+
+    d_operators[l] = std::move(Ac);
+  }
+
+  // inverse diagonals for the Jacobi smoother
+  for (size_t l = 0; l < nlevels; l++) {
+    const auto &Al = getOperator(l);
+    d_invDiag[l] = util::VectorXi(Al.rows(), 0.);
+
+    for (size_t k = 0; k < Al.rows(); k++)
+      if (std::abs(Al(k, k)) > 0.) d_invDiag[l][k] = 1. / Al(k, k);
+  }
+
+  // factorize the coarsest operator
+  d_coarseLU = getOperator(nlevels - 1);
+  d_pivots.resize(d_coarseLU.rows());
+  blaze::getrf(d_coarseLU, d_pivots.data());
+}
+
+util::VectorXi util::GeometricMultigrid::vcycle(const util::VectorXi &r) const {
+  return vcycle(0, r);
+}
+
+util::VectorXi util::GeometricMultigrid::vcycle(
+    size_t l, const util::VectorXi &b) const {
+  // exact solve on the coarsest level
+  if (l + 1 == getNumLevels()) {
+    util::VectorXi x = b;
+    blaze::getrs(d_coarseLU, x, 'N', d_pivots.data());
+    return x;
+  }
+
+  const auto &A = getOperator(l);
+  const double omega = 2. / 3.;
+
+  // pre-smoothing
+  util::VectorXi x = util::VectorXi(b.size(), 0.);
+  for (size_t s = 0; s < d_smoothingSteps; s++)
+    x += omega * (d_invDiag[l] * (b - A * x));
+
+  // coarse grid correction with restriction P^T
+  util::VectorXi r = b - A * x;
+  util::VectorXi rc = util::VectorXi(d_members[l].size(), 0.);
+  for (size_t k = 0; k < r.size(); k++) rc[d_coarseId[l][k]] += r[k];
+
+  util::VectorXi ec = vcycle(l + 1, rc);
+  for (size_t k = 0; k < x.size(); k++) x[k] += ec[d_coarseId[l][k]];
+
+  // post-smoothing
+  for (size_t s = 0; s < d_smoothingSteps; s++)
+    x += omega * (d_invDiag[l] * (b - A * x));
+
+  return x;
+}
+
+util::VectorXi util::GeometricMultigrid::solve(const util::VectorXi &b,
+                                               bool bicgstab, double tol,
+                                               size_t maxIters,
+                                               size_t &iterations,
+                                               double &residual) const {
+  const auto &A = *d_A0_p;
+  util::VectorXi x = util::VectorXi(b.size(), 0.);
+  util::VectorXi r = b;
+
+  double norm = util::l2Norm(b);
+  iterations = 0;
+  residual = 0.;
+
+  if (!(norm > 0.)) return x;
+
+  if (!bicgstab) {
+    // preconditioned conjugate gradient
+    util::VectorXi z = vcycle(r);
+    util::VectorXi p = z;
+    double rz = blaze::dot(r, z);
+
+    while (iterations < maxIters) {
+      util::VectorXi Ap = A * p;
+      double alpha = rz / blaze::dot(p, Ap);
+      x += alpha * p;
+      r -= alpha * Ap;
+      iterations++;
+
+      residual = util::l2Norm(r) / norm;
+      if (residual <= tol) break;
+
+      z = vcycle(r);
+      double rz_new = blaze::dot(r, z);
+      p = z + (rz_new / rz) * p;
+      rz = rz_new;
+    }
+
+    return x;
+  }
+
+  // right preconditioned BiCGSTAB
+  util::VectorXi rhat = r;
+  util::VectorXi p = util::VectorXi(b.size(), 0.);
+  util::VectorXi v = util::VectorXi(b.size(), 0.);
+  double rho = 1., alpha = 1., omega = 1.;
+
+  while (iterations < maxIters) {
+    double rho_new = blaze::dot(rhat, r);
+    double beta = (rho_new / rho) * (alpha / omega);
+    p = r + beta * (p - omega * v);
+
+    util::VectorXi phat = vcycle(p);
+    v = A * phat;
+    alpha = rho_new / blaze::dot(rhat, v);
+
+    util::VectorXi s = r - alpha * v;
+    iterations++;
+
+    residual = util::l2Norm(s) / norm;
+    if (residual <= tol) {
+      x += alpha * phat;
+      break;
+    }
+
+    util::VectorXi shat = vcycle(s);
+    util::VectorXi t = A * shat;
+    omega = blaze::dot(t, s) / blaze::dot(t, t);
+
+    x += alpha * phat + omega * shat;
+    r = s - omega * t;
+    rho = rho_new;
+
+    residual = util::l2Norm(r) / norm;
+    if (residual <= tol) break;
+  }
+
+  return x;
+}
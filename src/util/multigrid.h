@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UTIL_MULTIGRID_H
+#define UTIL_MULTIGRID_H
+
+#include <vector>
+
+#include "util/matrixBlaze.h"
+#include "util/point.h"  // definition of Point3
+
+namespace util {
+
+/*! @brief Geometric multigrid for the reduced Jacobian of the quasi-static
+ * model
+ *
+ * The hierarchy of coarse point sets is built from the mesh. On each level,
+ * the degrees of freedom are aggregated per direction over cells of twice
+ * the size of the previous level. Prolongation P is piecewise constant over
+ * an aggregate and restriction is its transpose, i.e. the sum over an
+ * aggregate. The coarse operators are the Galerkin products \f$ A_{l+1} =
+ * P_l^T A_l P_l \f$ and the coarsest one is solved by LU decomposition.
+ * Damped Jacobi is used as smoother.
+ *
+ * For a symmetric matrix, one V-cycle with the same number of pre- and
+ * post-smoothing steps is a symmetric preconditioner, so that it can be used
+ * with conjugate gradient as well as with BiCGSTAB.
+ */
+class GeometricMultigrid {
+
+public:
+  /*!
+   * @brief Constructor
+   *
+   * Builds the hierarchy of point sets and the transfer operators.
+   *
+   * @param nodes Nodal coordinates
+   * @param volumes Nodal volumes, used for the position of coarse points
+   * @param dofMap Map from global DOF (node * dim + direction) to free DOF
+   * id, -1 for constrained DOFs
+   * @param dim Dimension
+   * @param h Mesh size
+   * @param maxLevels Maximum number of levels (including the finest)
+   * @param coarseSize Coarsening stops once a level has at most this number
+   * of DOFs
+   * @param smoothingSteps Number of pre- and post-smoothing steps
+   */
+  GeometricMultigrid(const std::vector<util::Point3> &nodes,
+                     const std::vector<double> &volumes,
+                     const std::vector<long int> &dofMap, size_t dim, double h,
+                     size_t maxLevels, size_t coarseSize,
+                     size_t smoothingSteps);
+
+  /*!
+   * @brief Computes the coarse operators for the given matrix
+   *
+   * Has to be called whenever the matrix changes.
+   *
+   * @param A Matrix of the finest level
+   */
+  void setup(const util::Matrixij &A);
+
+  /*!
+   * @brief Applies one V-cycle to approximate \f$ A^{-1} r \f$
+   * @param r Vector
+   * @return Approximation of the solution
+   */
+  util::VectorXi vcycle(const util::VectorXi &r) const;
+
+  /*!
+   * @brief Solves \f$ A x = b \f$ with the preconditioned Krylov method
+   * @param b Right hand side
+   * @param bicgstab If true use BiCGSTAB, otherwise conjugate gradient
+   * @param tol Tolerance relative to the norm of b
+   * @param maxIters Maximum number of iterations
+   * @param iterations Number of iterations needed
+   * @param residual Norm of the residual of the solution relative to the
+   * norm of b
+   * @return Solution
+   */
+  util::VectorXi solve(const util::VectorXi &b, bool bicgstab, double tol,
+                       size_t maxIters, size_t &iterations,
+                       double &residual) const;
+
+  /*!
+   * @brief Returns the number of levels
+   * @return Number of levels
+   */
+  size_t getNumLevels() const { return d_coarseId.size() + 1; }
+
+private:
+  /*!
+   * @brief Recursive V-cycle
+   * @param l Level
+   * @param b Right hand side on level l
+   * @return Approximation of the solution on level l
+   */
+  util::VectorXi vcycle(size_t l, const util::VectorXi &b) const;
+
+  /*!
+   * @brief Returns the operator of level l
+   * @param l Level
+   * @return Operator
+   */
+  const util::Matrixij &getOperator(size_t l) const {
+    return l == 0 ? *d_A0_p : d_operators[l - 1];
+  }
+
+  /*! @brief Operator of the finest level */
+  const util::Matrixij *d_A0_p;
+
+  /*! @brief Coarse DOF of each DOF of level l */
+  std::vector<std::vector<size_t>> d_coarseId;
+
+  /*! @brief DOFs of level l aggregated to each DOF of level l+1 */
+  std::vector<std::vector<std::vector<size_t>>> d_members;
+
+  /*! @brief Operators of levels 1, 2, ... */
+  std::vector<util::Matrixij> d_operators;
+
+  /*! @brief Inverse of the diagonal of the operators of all levels */
+  std::vector<util::VectorXi> d_invDiag;
+
+  /*! @brief LU factorization of the coarsest operator */
+  util::ColMatrixij d_coarseLU;
+
+  /*! @brief Pivots of the LU factorization */
+  std::vector<int> d_pivots;
+
+  /*! @brief Number of pre- and post-smoothing steps */
+  size_t d_smoothingSteps;
+};
+
+} // namespace util
+
+#endif // UTIL_MULTIGRID_H
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include "numa.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+
+#include "util/utilIO.h"
+
+util::Numa *util::Numa::d_instance_p = nullptr;
+
+util::Numa *util::Numa::getInstance() {
+  if (d_instance_p == nullptr) d_instance_p = new util::Numa();
+
+  return d_instance_p;
+}
+
+void util::Numa::destroyInstance() {
+  delete d_instance_p;
+  d_instance_p = nullptr;
+}
+
+util::Numa::Numa() {
+  // one executor per domain, each bound to the cores of its domain
+  auto targets = hpx::compute::host::numa_domains();
+  if (targets.size() < 2) return;
+
+  d_executors.reserve(targets.size());
+  for (const auto &target : targets)
+    d_executors.emplace_back(
+        std::vector<hpx::compute::host::target>{target});
+}
+
+void util::Numa::releasePages(void *p, size_t bytes) {
+#ifdef __linux__
+  const auto page = std::uintptr_t(sysconf(_SC_PAGESIZE));
+  auto begin = (std::uintptr_t(p) + page - 1) / page * page;
+  auto end = (std::uintptr_t(p) + bytes) / page * page;
+  if (begin >= end) return;
+
+  if (madvise(reinterpret_cast<void *>(begin), end - begin, MADV_DONTNEED) !=
+      0)
+    std::cout << "Warning: Releasing pages for NUMA placement failed.\n";
+#endif
+}
+
+void util::Numa::adviseHugePages(void *p, size_t bytes) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  const auto page = std::uintptr_t(sysconf(_SC_PAGESIZE));
+  auto begin = (std::uintptr_t(p) + page - 1) / page * page;
+  auto end = (std::uintptr_t(p) + bytes) / page * page;
+  if (begin >= end) return;
+
+  // only a hint, kernels without transparent huge pages ignore it
+  madvise(reinterpret_cast<void *>(begin), end - begin, MADV_HUGEPAGE);
+#endif
+}
+
+std::string util::Numa::printStr(int nt, int lvl) const {
+  auto tabS = util::io::getTabS(nt);
+  std::ostringstream oss;
+  oss << tabS << "------- Numa --------" << std::endl << std::endl;
+  oss << tabS << "Number of NUMA domains = " << std::max(getNumDomains(),
+                                                         size_t(1))
+      << std::endl;
+  oss << tabS << std::endl;
+
+  return oss.str();
+}
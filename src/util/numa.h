@@ -0,0 +1,206 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UTIL_NUMA_H
+#define UTIL_NUMA_H
+
+#include <hpx/include/compute.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/parallel_algorithm.hpp>
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace util {
+
+/*! @brief Maps nodes to NUMA domains and runs loops on the owning domain
+ *
+ * The range of n nodes is cut into contiguous blocks of equal size, block d
+ * belonging to NUMA domain d. The mapping only depends on n and the number
+ * of domains and is used both for the first touch of the data and for the
+ * loops over nodes, so that threads of a domain work on memory of the same
+ * domain.
+ *
+ * Pages of std::vector are placed on the domain of the thread writing them
+ * first, which is the main thread for the values written by the
+ * constructor. Therefore, allocate() and distribute() release the pages of
+ * the data and write the data again from the owning domains.
+ *
+ * With a single NUMA domain, all methods fall back to the default parallel
+ * execution policy.
+ */
+class Numa {
+
+public:
+  /*!
+   * @brief Returns the pointer to the NUMA mapping
+   * @return Pointer Pointer to the NUMA mapping
+   */
+  static Numa *getInstance();
+
+  /*!
+   * @brief Destroys the NUMA mapping (before the runtime is stopped)
+   */
+  static void destroyInstance();
+
+  /*!
+   * @brief Returns the number of NUMA domains
+   * @return N Number of domains
+   */
+  size_t getNumDomains() const { return d_executors.size(); }
+
+  /*!
+   * @brief Returns the executor bound to a domain
+   * @param d Id of domain
+   * @return Executor Executor of domain
+   */
+  hpx::compute::host::block_executor<> &getExecutor(size_t d) {
+    return d_executors[d];
+  }
+
+  /*!
+   * @brief Returns the range of nodes owned by a domain
+   * @param d Id of domain
+   * @param n Number of nodes
+   * @return Pair First and one past the last node of the domain
+   */
+  std::pair<size_t, size_t> getRange(size_t d, size_t n) const {
+    const size_t nd = getNumDomains();
+    return {d * n / nd, (d + 1) * n / nd};
+  }
+
+  /*!
+   * @brief Parallel loop over nodes on the domains owning the nodes
+   * @param n Number of nodes
+   * @param f Function called for every node id
+   */
+  template <class F> void forLoop(size_t n, F &&f) {
+    if (getNumDomains() < 2) {
+      hpx::experimental::for_loop(hpx::execution::par, 0, n, f);
+      return;
+    }
+
+    std::vector<hpx::future<void>> fs;
+    fs.reserve(getNumDomains());
+    for (size_t d = 0; d < getNumDomains(); d++) {
+      auto r = getRange(d, n);
+      fs.push_back(hpx::experimental::for_loop(
+          hpx::execution::par(hpx::execution::task).on(d_executors[d]),
+          r.first, r.second, f));
+    }
+
+    for (auto &fi : fs) fi.get();
+  }
+
+  /*!
+   * @brief Allocates a vector whose pages are placed on the owning domains
+   *
+   * The pages are advised to be backed by transparent huge pages to reduce
+   * TLB misses in loops over nodes.
+   *
+   * @param n Number of nodes
+   * @param value Initial value
+   * @return Pointer Pointer to the vector
+   */
+  template <class T> std::vector<T> *allocate(size_t n, const T &value) {
+    auto *v = new std::vector<T>(n, value);
+    adviseHugePages(v->data(), n * sizeof(T));
+    if (getNumDomains() < 2) return v;
+
+    releasePages(v->data(), n * sizeof(T));
+    forLoop(n, [v, &value](boost::uint64_t i) { (*v)[i] = value; });
+    return v;
+  }
+
+  /*!
+   * @brief Moves the pages of an existing vector to the owning domains
+   *
+   * The data type must not own memory, e.g. double or util::Point3.
+   *
+   * @param v Vector with one entry per node
+   */
+  template <class T> void distribute(std::vector<T> &v) {
+    if (getNumDomains() < 2 or v.empty()) return;
+
+    std::vector<T> copy(v);
+    releasePages(v.data(), v.size() * sizeof(T));
+    forLoop(v.size(), [&v, &copy](boost::uint64_t i) { v[i] = copy[i]; });
+  }
+
+  /*!
+   * @brief Reallocates the lists of nodes from the owning domains
+   * @param v Vector with one list per node
+   */
+  template <class T> void distribute(std::vector<std::vector<T>> &v) {
+    if (getNumDomains() < 2) return;
+
+    forLoop(v.size(), [&v](boost::uint64_t i) {
+      std::vector<T>(v[i]).swap(v[i]);
+    });
+  }
+
+  /*!
+   * @brief Returns the string containing information about the instance of
+   * the object
+   *
+   * @param nt Number of tabs to append before each line of string
+   * @param lvl Level of information sought (higher level means more
+   * information)
+   * @return string String containing information about this object
+   * */
+  std::string printStr(int nt = 0, int lvl = 0) const;
+
+  /*!
+   * @brief Prints the information about the instance of the object
+   *
+   * @param nt Number of tabs to append before each line of string
+   * @param lvl Level of information sought (higher level means more
+   * information)
+   * */
+  void print(int nt = 0, int lvl = 0) const { std::cout << printStr(nt, lvl); };
+
+private:
+  /*!
+   * @brief Constructor
+   */
+  Numa();
+
+  /*!
+   * @brief Releases the pages of a memory region so that they are placed
+   * on the domain of the thread writing them next
+   *
+   * Only pages which lie completely in the region are released. Released
+   * pages read as zero.
+   *
+   * @param p Pointer to memory
+   * @param bytes Size of memory in bytes
+   */
+  static void releasePages(void *p, size_t bytes);
+
+  /*!
+   * @brief Advises the kernel to back a memory region by huge pages
+   *
+   * Only pages which lie completely in the region are advised.
+   *
+   * @param p Pointer to memory
+   * @param bytes Size of memory in bytes
+   */
+  static void adviseHugePages(void *p, size_t bytes);
+
+  /*! @brief Pointer to the NUMA mapping */
+  static Numa *d_instance_p;
+
+  /*! @brief Executors bound to the NUMA domains */
+  std::vector<hpx::compute::host::block_executor<>> d_executors;
+};
+
+} // namespace util
+
+#endif // UTIL_NUMA_H
@@ -10,6 +10,7 @@
 #define UTIL_PARALELL_H
 
 #include<hpx/include/parallel_copy.hpp>
+#include<hpx/include/parallel_fill.hpp>
 
 namespace util {
 
@@ -62,6 +63,18 @@ inline void subInplace(T &a, T b) {
 			});
 }
 
+/*
+ *  @brief Sets all values of the container a to value using HPX's parallel algorithms
+ *  @param a The container
+ *  @param value The value
+ *  @note The container has to be a container form the c++ standard (std::vector, std::array, or std::list).
+ */
+template<typename T, typename V>
+inline void fill(T &a, const V &value) {
+
+	hpx::fill(hpx::execution::par, a.begin(), a.end(), value);
+}
+
 }
 
 }
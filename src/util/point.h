@@ -112,6 +112,15 @@ struct Point3 {
    */
   void print(int nt = 0, int lvl = 0) const { std::cout << printStr(nt, lvl); }
 
+  /*!
+   * @brief Serializes the point to send it to another locality
+   * @param ar Archive
+   * @param version Version of archive
+   */
+  template <class Archive> void serialize(Archive &ar, unsigned version) {
+    ar & d_x & d_y & d_z;
+  }
+
   /*!
    * @brief Computes the Euclidean length of the vector
    * @return Length Euclidean length of the vector
@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include "profiler.h"
+
+#include <sys/resource.h>
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+/*! @brief Names of phases in the report */
+const std::array<std::string, size_t(util::Phase::Count)> c_phaseNames = {
+    "mesh_read", "neighbor_build", "fracture_init",   "material_init",
+    "loading",   "force",          "integration",     "post_processing",
+    "output",    "output_write"};
+
+/*!
+ * @brief Returns the peak resident set size of the process
+ * @return Size Peak resident set size in kilo bytes
+ */
+long peakRSS() {
+  struct rusage usage {};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+  return usage.ru_maxrss;
+}
+
+} // namespace
+
+util::Profiler *util::Profiler::d_instance_p = nullptr;
+
+bool util::Profiler::d_enabled = false;
+
+util::Profiler *util::Profiler::getInstance() {
+  if (d_instance_p == nullptr) d_instance_p = new util::Profiler();
+
+  return d_instance_p;
+}
+
+void util::Profiler::destroyInstance() {
+  d_enabled = false;
+  delete d_instance_p;
+  d_instance_p = nullptr;
+}
+
+util::Profiler::Profiler()
+    : d_bytes(0),
+      d_begin(0),
+      d_lastN(0),
+      d_lastTime(0.),
+      d_format("json") {}
+
+void util::Profiler::enable(const std::string &filename,
+                            const std::string &format) {
+  if (format != "json" and format != "csv") {
+    std::cerr << "Error: Profile format " << format
+              << " is not supported. Use json or csv.\n";
+    exit(1);
+  }
+
+  d_format = format;
+  d_file.open(filename + "." + format);
+  if (!d_file) {
+    std::cerr << "Error: Can not open file = " << filename + "." + format
+              << ".\n";
+    exit(1);
+  }
+
+  if (d_format == "csv") {
+    d_file << "event,step,time,wall";
+    for (const auto &name : c_phaseNames) d_file << "," << name;
+    d_file << ",output_build,bond_evaluations,bond_evaluations_per_sec,"
+              "bytes_written,peak_rss_kb\n";
+  }
+
+  d_begin = hpx::chrono::high_resolution_clock::now();
+  d_enabled = true;
+}
+
+void util::Profiler::report(size_t n, double time) {
+  if (!d_enabled) return;
+
+  write("output", n, time);
+}
+
+void util::Profiler::finalize() {
+  if (!d_enabled) return;
+
+  write("exit", d_lastN, d_lastTime);
+
+  double force = double(Counters::getTime(Phase::Force)) / 1.0e9;
+  std::cout << "Profiler: Force = " << force
+            << " sec, Integration = "
+            << double(Counters::getTime(Phase::Integration)) / 1.0e9
+            << " sec, Output = "
+            << double(Counters::getTime(Phase::Output)) / 1.0e9
+            << " sec, Bond evaluations per sec = "
+            << (force > 0. ? double(Counters::getBondEvaluations()) / force
+                           : 0.)
+            << ", Bytes written = " << d_bytes.load()
+            << ", Peak RSS = " << peakRSS() << " KB\n";
+
+  d_file.close();
+  d_enabled = false;
+}
+
+void util::Profiler::write(const std::string &event, size_t n, double time) {
+  std::lock_guard<std::mutex> lock(d_mutex);
+
+  d_lastN = n;
+  d_lastTime = time;
+
+  double wall =
+      double(hpx::chrono::high_resolution_clock::now() - d_begin) / 1.0e9;
+
+  std::vector<double> t(size_t(Phase::Count));
+  for (size_t i = 0; i < t.size(); i++)
+    t[i] = double(Counters::getTime(Phase(i))) / 1.0e9;
+  const std::uint64_t bonds = Counters::getBondEvaluations();
+
+  double force = t[size_t(Phase::Force)];
+  double outputBuild =
+      t[size_t(Phase::Output)] - t[size_t(Phase::OutputWrite)];
+  double bondsPerSec = force > 0. ? double(bonds) / force : 0.;
+
+  std::ostringstream oss;
+  oss.precision(9);
+  if (d_format == "json") {
+    oss << "{\"event\": \"" << event << "\", \"step\": " << n
+        << ", \"time\": " << time << ", \"wall\": " << wall;
+    for (size_t i = 0; i < t.size(); i++)
+      oss << ", \"" << c_phaseNames[i] << "\": " << t[i];
+    oss << ", \"output_build\": " << outputBuild
+        << ", \"bond_evaluations\": " << bonds
+        << ", \"bond_evaluations_per_sec\": " << bondsPerSec
+        << ", \"bytes_written\": " << d_bytes.load()
+        << ", \"peak_rss_kb\": " << peakRSS() << "}\n";
+  } else {
+    oss << event << "," << n << "," << time << "," << wall;
+    for (double ti : t) oss << "," << ti;
+    oss << "," << outputBuild << "," << bonds << "," << bondsPerSec
+        << "," << d_bytes.load() << "," << peakRSS() << "\n";
+  }
+
+  d_file << oss.str();
+  d_file.flush();
+}
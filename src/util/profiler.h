@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UTIL_PROFILER_H
+#define UTIL_PROFILER_H
+
+#include "util/counters.h"  // definition of Phase
+
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+namespace util {
+
+/*! @brief Reports time per phase and throughput of the simulation
+ *
+ * The profiler is a singleton which is disabled by default. Once enabled,
+ * the time spent in each phase, the number of bond evaluations, the bytes
+ * written in output files, and the peak resident set size are written as
+ * JSON (one object per line) or CSV (one row per report) at every output
+ * interval and at exit.
+ *
+ * Time per phase and bond evaluations are read from util::Counters, which
+ * are collected also when the profiler is disabled.
+ */
+class Profiler {
+
+public:
+  /*!
+   * @brief Returns the pointer to the profiler
+   * @return Pointer Pointer to the profiler
+   */
+  static Profiler *getInstance();
+
+  /*!
+   * @brief Destroys the profiler
+   */
+  static void destroyInstance();
+
+  /*!
+   * @brief Returns true if the profiler is enabled
+   * @return True If profiling is enabled
+   */
+  static bool isEnabled() { return d_enabled; }
+
+  /*!
+   * @brief Enables the profiler and opens the report file
+   * @param filename Filename of report without extension
+   * @param format Format of report (json or csv)
+   */
+  void enable(const std::string &filename, const std::string &format);
+
+  /*!
+   * @brief Adds number of bytes written to the file system
+   * @param n Number of bytes
+   */
+  void addBytesWritten(std::uint64_t n) { d_bytes += n; }
+
+  /*!
+   * @brief Writes the current state of the profiler to the report
+   * @param n Current time step
+   * @param time Current time
+   */
+  void report(size_t n, double time);
+
+  /*!
+   * @brief Writes the final report, prints a summary and closes the file
+   */
+  void finalize();
+
+private:
+  /*!
+   * @brief Constructor
+   */
+  Profiler();
+
+  /*!
+   * @brief Writes a record to the report file
+   * @param event Name of event (output or exit)
+   * @param n Current time step
+   * @param time Current time
+   */
+  void write(const std::string &event, size_t n, double time);
+
+  /*! @brief Pointer to the profiler */
+  static Profiler *d_instance_p;
+
+  /*! @brief Flag which indicates if profiling is enabled */
+  static bool d_enabled;
+
+  /*! @brief Number of bytes written */
+  std::atomic<std::uint64_t> d_bytes;
+
+  /*! @brief Time when profiler was enabled in nano seconds */
+  std::uint64_t d_begin;
+
+  /*! @brief Last time step reported */
+  size_t d_lastN;
+
+  /*! @brief Last time reported */
+  double d_lastTime;
+
+  /*! @brief Format of report */
+  std::string d_format;
+
+  /*! @brief Report file */
+  std::ofstream d_file;
+
+  /*! @brief Mutex to serialize writing of records */
+  std::mutex d_mutex;
+};
+
+/*! @brief Times a scope and adds the time to a phase of util::Counters */
+class ScopedTimer {
+
+public:
+  /*!
+   * @brief Constructor
+   * @param phase Phase
+   */
+  explicit ScopedTimer(Phase phase)
+      : d_phase(phase), d_begin(hpx::chrono::high_resolution_clock::now()) {}
+
+  ScopedTimer(const ScopedTimer &) = delete;
+  ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+  /*!
+   * @brief Destructor
+   */
+  ~ScopedTimer() {
+    Counters::addTime(d_phase,
+                      hpx::chrono::high_resolution_clock::now() - d_begin);
+  }
+
+private:
+  /*! @brief Phase */
+  Phase d_phase;
+
+  /*! @brief Begin time in nano seconds */
+  std::uint64_t d_begin;
+};
+
+} // namespace util
+
+#endif // UTIL_PROFILER_H
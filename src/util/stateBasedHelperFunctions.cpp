@@ -13,71 +13,79 @@
 #include "util/compare.h"
 
 util::StateBasedHelperFunctions::StateBasedHelperFunctions(
-    data::DataManager *dataManager, double factor) {
-  if (dataManager->getExtensionP() != nullptr)
-    delete dataManager->getExtensionP();
+    data::DataManager *dataManager, double factor)
+    : d_dataManager_p(dataManager),
+      d_dim(dataManager->getModelDeckP()->d_dim),
+      d_factor(factor) {
+  allocate();
+  update();
+}
 
-  dataManager->setExtensionP(new std::vector<std::vector<double>>(
-      dataManager->getMeshP()->getNodesP()->size()));
+void util::StateBasedHelperFunctions::allocate() {
+  size_t nnodes = d_dataManager_p->getMeshP()->getNodesP()->size();
+  auto *neighbors = d_dataManager_p->getNeighborP();
 
-  dilatation(dataManager, dataManager->getModelDeckP()->d_dim, factor);
-}
+  auto *extension = d_dataManager_p->getExtensionP();
+  if (extension == nullptr or extension->size() != nnodes) {
+    delete extension;
+    extension = new std::vector<std::vector<double>>(nnodes);
+    d_dataManager_p->setExtensionP(extension);
+  }
 
-void util::StateBasedHelperFunctions::dilatation(data::DataManager *dataManager,
-                                                 size_t dim, double factor) {
-  if (dataManager->getDilatationP() != nullptr)
-    delete dataManager->getDilatationP();
+  for (size_t i = 0; i < nnodes; i++)
+    (*extension)[i].resize(neighbors->getNeighbors(i).size(), 0.);
 
-  dataManager->setDilatationP(new std::vector<double>(
-      dataManager->getMeshP()->getNodesP()->size(), 0.));
+  auto *dilatation = d_dataManager_p->getDilatationP();
+  if (dilatation == nullptr or dilatation->size() != nnodes) {
+    delete dilatation;
+    d_dataManager_p->setDilatationP(new std::vector<double>(nnodes, 0.));
+  }
+}
 
+void util::StateBasedHelperFunctions::update() {
   hpx::experimental::for_loop(
-      hpx::execution::par, 0, dataManager->getMeshP()->getNodesP()->size(),
-      [&](boost::uint64_t i) {
-        size_t k = 0;
-        double w = 1;
-        for (auto j : dataManager->getNeighborP()->getNeighbors(i)) {
-          util::Point3 Y = ((*dataManager->getMeshP()->getNodesP())[j] +
-                            (*dataManager->getDisplacementP())[j]) -
-                           ((*dataManager->getMeshP()->getNodesP())[i] +
-                            (*dataManager->getDisplacementP())[i]);
-          util::Point3 X = (*dataManager->getMeshP()->getNodesP())[j] -
-                           (*dataManager->getMeshP()->getNodesP())[i];
-
-          (*dataManager->getExtensionP())[i].push_back(Y.length() - X.length());
-
-          switch (dim) {
-            case 1:
-              (*dataManager->getDilatationP())[i] +=
-                  (1. / (*dataManager->getVolumeCorrectionP()
-                              ->d_weightedVolume_p)[i]) *
-                  w * X.length() * (*dataManager->getExtensionP())[i][k] *
-                  (*dataManager->getVolumeCorrectionP()
-                        ->d_volumeCorrection_p)[i][k] *
-                  (dataManager->getMeshP()->getNodalVolume(j));
-              break;
-            case 2:
-              (*dataManager->getDilatationP())[i] +=
-                  (2. / (*dataManager->getVolumeCorrectionP()
-                              ->d_weightedVolume_p)[i]) *
-                  factor * w * X.length() *
-                  (*dataManager->getExtensionP())[i][k] *
-                  (*dataManager->getVolumeCorrectionP()
-                        ->d_volumeCorrection_p)[i][k] *
-                  (dataManager->getMeshP()->getNodalVolume(j));
-              break;
-            case 3:
-              (*dataManager->getDilatationP())[i] +=
-                  (3. / (*dataManager->getVolumeCorrectionP()
-                              ->d_weightedVolume_p)[i]) *
-                  w * X.length() * (*dataManager->getExtensionP())[i][k] *
-                  (*dataManager->getVolumeCorrectionP()
-                        ->d_volumeCorrection_p)[i][k] *
-                  (dataManager->getMeshP()->getNodalVolume(j));
-              break;
-          }
-
-          k++;
-        }
-      });
+      hpx::execution::par, 0, d_dataManager_p->getMeshP()->getNodesP()->size(),
+      [&](boost::uint64_t i) { updateNode(i); });
+}
+
+void util::StateBasedHelperFunctions::updateNode(size_t i) {
+  const auto &nodes = *d_dataManager_p->getMeshP()->getNodesP();
+  const auto &vols = *d_dataManager_p->getMeshP()->getNodalVolumesP();
+  const auto &disp = *d_dataManager_p->getDisplacementP();
+  const auto *volCorr = d_dataManager_p->getVolumeCorrectionP();
+  const auto &i_neighs = d_dataManager_p->getNeighborP()->getNeighbors(i);
+
+  auto &extension = (*d_dataManager_p->getExtensionP())[i];
+
+  // scaling of the dilatation depending on the dimension
+  double scale = 0.;
+  switch (d_dim) {
+    case 1:
+      scale = 1.;
+      break;
+    case 2:
+      scale = 2. * d_factor;
+      break;
+    case 3:
+      scale = 3.;
+      break;
+  }
+  scale /= (*volCorr->d_weightedVolume_p)[i];
+
+  double w = 1;
+  double theta = 0.;
+
+  for (size_t k = 0; k < i_neighs.size(); k++) {
+    size_t j = i_neighs[k];
+
+    util::Point3 Y = (nodes[j] + disp[j]) - (nodes[i] + disp[i]);
+    util::Point3 X = nodes[j] - nodes[i];
+
+    extension[k] = Y.length() - X.length();
+
+    theta += scale * w * X.length() * extension[k] *
+             (*volCorr->d_volumeCorrection_p)[i][k] * vols[j];
+  }
+
+  (*d_dataManager_p->getDilatationP())[i] = theta;
 }
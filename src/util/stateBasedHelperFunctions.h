@@ -53,20 +53,49 @@ public:
 
 	/*!
 	 * @brief Constructor
+	 *
+	 * Allocates the extension and dilatation arrays, if they are not already
+	 * allocated in the data manager, and computes them for the current
+	 * displacement.
+	 *
 	 * @param dataManager Pointer to the data manager object
 	 * @param factor Scaling factor for 2D case
 	 */
 	StateBasedHelperFunctions(data::DataManager* dataManager,
 			double factor);
+
+	/*!
+	 * @brief Recomputes the extension and dilatation of all nodes in place
+	 */
+	void update();
+
+	/*!
+	 * @brief Recomputes the extension and dilatation of node i in place
+	 *
+	 * Node i only reads the displacement and writes its own row of the
+	 * extension and its own dilatation, so nodes can be updated concurrently.
+	 *
+	 * @param i Id of node
+	 */
+	void updateNode(size_t i);
+
 private:
+
 	/*!
-	 * @brief Computes the extension \f$ e_i = \vert \eta + \xi \vert - \vert \xi \vert \f$ and
-	 * dilatation \f$ \sum\limits_{B_\delta(x_i)} \frac{3}{m_i} \vert \xi \vert e_i V_j \f$ for each node where $m_i$ is the weighted volume.
-	 * @param dataManager Class holding all the global simulation data
-	 * @param dim Dimension of the problem
-	 * @param factor Dimensional depended material property
+	 * @brief Allocates the extension and dilatation arrays
+	 *
+	 * The arrays are reused if they already match the neighbor list.
 	 */
-	void dilatation(data::DataManager *dataManager, size_t dim, double factor);
+	void allocate();
+
+	/*! @brief Pointer to the data manager object */
+	data::DataManager *d_dataManager_p;
+
+	/*! @brief Dimension of the problem */
+	size_t d_dim;
+
+	/*! @brief Dimensional depended material property */
+	double d_factor;
 
 };
 
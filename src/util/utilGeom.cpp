@@ -8,6 +8,7 @@
 
 #include "utilGeom.h"
 
+#include <algorithm>
 #include <cmath>  // definition of sin, cosine etc
 #include <iostream>
 
@@ -333,3 +334,26 @@ bool util::geometry::isPointinCircle(const util::Point3 A,
 
   return false;
 }
+
+uint64_t util::geometry::getMortonKey(const util::Point3 &x,
+                                      const util::Point3 &x_min,
+                                      const util::Point3 &x_max) {
+  const uint64_t max_q = (uint64_t(1) << 21) - 1;
+
+  uint64_t key = 0;
+  for (size_t d = 0; d < 3; d++) {
+    double l = x_max[d] - x_min[d];
+    uint64_t q = 0;
+    if (l > 0.) {
+      double r = (x[d] - x_min[d]) / l;
+      r = std::max(0., std::min(1., r));
+      q = uint64_t(r * double(max_q));
+    }
+
+    // spread the bits of q such that there are two zero bits between them
+    for (size_t b = 0; b < 21; b++)
+      key |= ((q >> b) & uint64_t(1)) << (3 * b + d);
+  }
+
+  return key;
+}
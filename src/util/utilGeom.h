@@ -10,6 +10,7 @@
 #define UTIL_GEOMETRY_H
 
 #include "point.h"              // definition of Point3
+#include <cstdint>
 #include <vector>
 
 namespace util {
@@ -154,6 +155,21 @@ int direction(util::Point3 A , util::Point3 B, util::Point3 C);
  */
 bool isPointinCircle(util::Point3 A, util::Point3 center, double radius);
 
+/*!
+ * @brief Returns the key of the point on the Morton (z-order) curve
+ *
+ * Coordinates are quantized to 21 bits relative to the bounding box and the
+ * bits of the three coordinates are interleaved. Sorting points by the key
+ * groups points which are close in space.
+ *
+ * @param x Point
+ * @param x_min Lower corner of the bounding box
+ * @param x_max Upper corner of the bounding box
+ * @return key Morton key
+ */
+uint64_t getMortonKey(const util::Point3 &x, const util::Point3 &x_min,
+                      const util::Point3 &x_max);
+
 } // namespace geometry
 
 } // namespace util
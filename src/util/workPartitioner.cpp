@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include "workPartitioner.h"
+
+#include <hpx/include/runtime.hpp>
+
+#include <algorithm>
+#include <sstream>
+
+#include "util/utilIO.h"
+
+const std::vector<size_t> util::WorkPartitioner::c_candidates = {1, 2, 4, 8,
+                                                                 16};
+
+util::WorkPartitioner::WorkPartitioner(size_t chunksPerThread)
+    : d_chunksPerThread(chunksPerThread) {}
+
+void util::WorkPartitioner::setCosts(const std::vector<double> &cost) {
+  d_prefix.resize(cost.size() + 1);
+  d_prefix[0] = 0.;
+  for (size_t i = 0; i < cost.size(); i++)
+    d_prefix[i + 1] = d_prefix[i] + cost[i];
+
+  build();
+}
+
+void util::WorkPartitioner::setChunksPerThread(size_t chunksPerThread) {
+  d_chunksPerThread = chunksPerThread;
+  build();
+}
+
+void util::WorkPartitioner::build() {
+  if (d_prefix.empty()) return;
+
+  const size_t nnodes = d_prefix.size() - 1;
+  auto *numa = Numa::getInstance();
+  const size_t ndomains = std::max(numa->getNumDomains(), size_t(1));
+  const size_t nthreads = std::max(hpx::get_os_thread_count(), size_t(1));
+
+  // chunks of a domain for the threads of the domain
+  const size_t nchunks =
+      std::max(std::max(d_chunksPerThread, size_t(1)) * nthreads / ndomains,
+               size_t(1));
+
+  d_chunks.assign(1, 0);
+  d_domainChunks.assign(1, 0);
+  for (size_t d = 0; d < ndomains; d++) {
+    auto r = numa->getNumDomains() < 2 ? std::make_pair(size_t(0), nnodes)
+                                       : numa->getRange(d, nnodes);
+
+    // cut where the prefix sum reaches the next multiple of the target cost
+    const double begin = d_prefix[r.first];
+    const double cost = d_prefix[r.second] - begin;
+    for (size_t c = 1; c < nchunks; c++) {
+      double target = begin + cost * double(c) / double(nchunks);
+      size_t i = std::lower_bound(d_prefix.begin() + r.first,
+                                  d_prefix.begin() + r.second, target) -
+                 d_prefix.begin();
+      if (i > d_chunks.back()) d_chunks.push_back(i);
+    }
+
+    if (r.second > d_chunks.back()) d_chunks.push_back(r.second);
+    d_domainChunks.push_back(d_chunks.size() - 1);
+  }
+}
+
+double util::WorkPartitioner::getImbalance() const {
+  if (getNumChunks() == 0 or d_prefix.back() <= 0.) return 1.;
+
+  double max_cost = 0.;
+  for (size_t c = 0; c < getNumChunks(); c++)
+    max_cost =
+        std::max(max_cost, d_prefix[d_chunks[c + 1]] - d_prefix[d_chunks[c]]);
+
+  return max_cost * double(getNumChunks()) / d_prefix.back();
+}
+
+std::string util::WorkPartitioner::printStr(int nt, int lvl) const {
+  auto tabS = util::io::getTabS(nt);
+  std::ostringstream oss;
+  oss << tabS << "------- WorkPartitioner --------" << std::endl << std::endl;
+  oss << tabS << "Chunks per thread = " << d_chunksPerThread << std::endl;
+  oss << tabS << "Number of chunks = " << getNumChunks() << std::endl;
+  oss << tabS << "Imbalance of chunks = " << getImbalance() << std::endl;
+  oss << tabS << std::endl;
+
+  return oss.str();
+}
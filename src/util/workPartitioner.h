@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2019 Prashant K. Jha
+//  Copyright (c) 2019 Patrick Diehl
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UTIL_WORKPARTITIONER_H
+#define UTIL_WORKPARTITIONER_H
+
+#include "util/numa.h"
+
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/parallel_algorithm.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace util {
+
+/*! @brief Cuts the loop over nodes into chunks of equal cost
+ *
+ * The cost of each node is given by the caller, e.g. the number of bonds of
+ * the node. From the prefix sums of the costs, the nodes of each NUMA domain
+ * (see util::Numa) are cut into contiguous chunks with approximately equal
+ * cost, and every chunk is run as one task on the executor of its domain.
+ *
+ * The number of chunks per thread is either fixed or tuned by calibrate()
+ * which times the loop for a few candidates and keeps the fastest one.
+ */
+class WorkPartitioner {
+
+public:
+  /*!
+   * @brief Constructor
+   * @param chunksPerThread Number of chunks per thread (zero to calibrate)
+   */
+  explicit WorkPartitioner(size_t chunksPerThread = 0);
+
+  /*!
+   * @brief Sets the cost of nodes and rebuilds the chunks
+   * @param cost Cost of nodes
+   */
+  void setCosts(const std::vector<double> &cost);
+
+  /*!
+   * @brief Sets the number of chunks per thread and rebuilds the chunks
+   * @param chunksPerThread Number of chunks per thread
+   */
+  void setChunksPerThread(size_t chunksPerThread);
+
+  /*!
+   * @brief Returns the number of chunks per thread
+   * @return N Number of chunks per thread (zero if not yet calibrated)
+   */
+  size_t getChunksPerThread() const { return d_chunksPerThread; }
+
+  /*!
+   * @brief Returns the number of chunks
+   * @return N Number of chunks
+   */
+  size_t getNumChunks() const {
+    return d_chunks.empty() ? 0 : d_chunks.size() - 1;
+  }
+
+  /*!
+   * @brief Returns the ratio of the largest to the mean cost of chunks
+   * @return Ratio Imbalance of chunks
+   */
+  double getImbalance() const;
+
+  /*!
+   * @brief Parallel loop over nodes by chunks of equal cost
+   * @param f Function called for every node id
+   */
+  template <class F> void forLoop(F &&f) {
+    auto *numa = Numa::getInstance();
+    auto chunk = [this, &f](boost::uint64_t c) {
+      for (size_t i = this->d_chunks[c]; i < this->d_chunks[c + 1]; i++) f(i);
+    };
+
+    if (numa->getNumDomains() < 2) {
+      hpx::experimental::for_loop(
+          hpx::execution::par.with(hpx::execution::static_chunk_size(1)), 0,
+          getNumChunks(), chunk);
+      return;
+    }
+
+    std::vector<hpx::future<void>> fs;
+    fs.reserve(numa->getNumDomains());
+    for (size_t d = 0; d < numa->getNumDomains(); d++)
+      fs.push_back(hpx::experimental::for_loop(
+          hpx::execution::par(hpx::execution::task)
+              .on(numa->getExecutor(d))
+              .with(hpx::execution::static_chunk_size(1)),
+          d_domainChunks[d], d_domainChunks[d + 1], chunk));
+
+    for (auto &fi : fs) fi.get();
+  }
+
+  /*!
+   * @brief Chooses the number of chunks per thread with the fastest loop
+   *
+   * Each candidate is timed over a few repetitions of the loop. The function
+   * therefore must not change the state of the simulation.
+   *
+   * @param f Function called for every node id
+   * @param repeat Number of loops per candidate
+   */
+  template <class F> void calibrate(F &&f, size_t repeat = 3) {
+    size_t best = 0;
+    std::uint64_t best_time = 0;
+    for (auto c : c_candidates) {
+      setChunksPerThread(c);
+      forLoop(f);  // warm up
+
+      std::uint64_t begin = hpx::chrono::high_resolution_clock::now();
+      for (size_t k = 0; k < repeat; k++) forLoop(f);
+      std::uint64_t time = hpx::chrono::high_resolution_clock::now() - begin;
+
+      if (best == 0 or time < best_time) {
+        best = c;
+        best_time = time;
+      }
+    }
+
+    setChunksPerThread(best);
+  }
+
+  /*!
+   * @brief Returns the string containing information about the instance of
+   * the object
+   *
+   * @param nt Number of tabs to append before each line of string
+   * @param lvl Level of information sought (higher level means more
+   * information)
+   * @return string String containing information about this object
+   * */
+  std::string printStr(int nt = 0, int lvl = 0) const;
+
+  /*!
+   * @brief Prints the information about the instance of the object
+   *
+   * @param nt Number of tabs to append before each line of string
+   * @param lvl Level of information sought (higher level means more
+   * information)
+   * */
+  void print(int nt = 0, int lvl = 0) const { std::cout << printStr(nt, lvl); };
+
+private:
+  /*!
+   * @brief Cuts the nodes into chunks from the prefix sums of the cost
+   */
+  void build();
+
+  /*! @brief Candidates for number of chunks per thread in calibration */
+  static const std::vector<size_t> c_candidates;
+
+  /*! @brief Number of chunks per thread */
+  size_t d_chunksPerThread;
+
+  /*! @brief Prefix sums of cost of nodes */
+  std::vector<double> d_prefix;
+
+  /*! @brief First node of chunks followed by the number of nodes */
+  std::vector<size_t> d_chunks;
+
+  /*! @brief First chunk of NUMA domains followed by the number of chunks */
+  std::vector<size_t> d_domainChunks;
+};
+
+} // namespace util
+
+#endif // UTIL_WORKPARTITIONER_H
@@ -0,0 +1,52 @@
+# Copyright (c) 2019 Prashant K. Jha
+# Copyright (c) 2019 Patrick Diehl
+#
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# Runs the multigrid preconditioned solve of the inputs COARSE and FINE with
+# EXECUTABLE and fails if the linear solver does not converge or if the fine
+# mesh needs more than 1.5 times the iterations of the coarse mesh.
+#
+# Usage: cmake -DEXECUTABLE=<PeriHPX> -DCOARSE=<input> -DFINE=<input>
+#              -P multigridIterations.cmake
+
+foreach(run COARSE FINE)
+  execute_process(COMMAND ${EXECUTABLE} -i ${${run}} --hpx:threads=5
+    OUTPUT_VARIABLE output
+    RESULT_VARIABLE result)
+
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${${run}} failed with exit code ${result}")
+  endif()
+
+  if(output MATCHES "did not converge")
+    message(FATAL_ERROR "${${run}}: Multigrid preconditioned solver did not "
+      "converge")
+  endif()
+
+  # largest number of linear iterations over all Newton iterations
+  string(REGEX MATCHALL "Multigrid preconditioned solver iterations = [0-9]+"
+    lines "${output}")
+  set(iterations 0)
+  foreach(line ${lines})
+    string(REGEX REPLACE ".* = " "" n "${line}")
+    if(n GREATER iterations)
+      set(iterations ${n})
+    endif()
+  endforeach()
+
+  if(iterations EQUAL 0)
+    message(FATAL_ERROR "${${run}}: No multigrid preconditioned solve found")
+  endif()
+
+  message(STATUS "${${run}}: Linear iterations = ${iterations}")
+  set(${run}_ITERATIONS ${iterations})
+endforeach()
+
+math(EXPR limit "(3 * ${COARSE_ITERATIONS}) / 2")
+if(FINE_ITERATIONS GREATER limit)
+  message(FATAL_ERROR "Fine mesh needs ${FINE_ITERATIONS} linear iterations, "
+    "more than 1.5 times the ${COARSE_ITERATIONS} iterations of the coarse "
+    "mesh")
+endif()